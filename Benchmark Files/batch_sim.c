@@ -0,0 +1,257 @@
+/**
+ * @file batch_sim.c
+ * @brief Struct-of-arrays batch game player for very large simulations
+ *
+ * simulation.c plays one game at a time: a char board, a temp copy per
+ * move, and a full engine call per ply. This player advances BATCH_GAMES
+ * games in lockstep instead, held as parallel arrays of X-masks and
+ * O-masks (struct-of-arrays). Each ply is a sequence of tight passes
+ * over the whole batch - move selection from the tablebase, wide
+ * bitwise move application, then a win sweep that ANDs every line of
+ * WIN_MASKS across all games - so the compiler can vectorize the
+ * per-game operations and every pass streams through contiguous arrays.
+ *
+ * With moves served from the tablebase (one array load per ply) a
+ * single core pushes games at rates that make millon-game experiments
+ * routine; the built-in run sweeps X's error rate against a fixed
+ * opponent at 1,000,000 games per point and prints the throughput. A
+ * perfect-vs-perfect batch doubles as a correctness check: it must come
+ * out 100% draws.
+ *
+ * COMPILATION:
+ * gcc -o "Benchmark Files\batch_sim.exe" "Benchmark Files\batch_sim.c" "Game_algorithms\Minimax.c" "Game_algorithms\model_minimax.c" "Game_algorithms\minimax_utils.c" "Game_algorithms\rng.c" "Game_algorithms\tablebase.c" -I"Game_algorithms" -static -lm
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../Game_algorithms/minimax.h"
+#include "../Game_algorithms/minimax_utils.h"
+#include "../Game_algorithms/tablebase.h"
+
+// Configuration
+#define BATCH_GAMES 64          // Games advanced in lockstep
+#define GAMES_PER_POINT 1000000 // Games per sweep point
+#define OPP_ERROR_RATE 10       // Fixed O error rate across the sweep
+
+// ============================================================================
+// STRUCT-OF-ARRAYS BATCH STATE
+// ============================================================================
+
+/**
+ * @brief One batch of games in struct-of-arrays layout.
+ *
+ * Every per-game field is its own array, so a pass over the batch reads
+ * and writes contiguous memory: maskX[0..63], not 64 interleaved game
+ * structs. moveBit is the staging area between the (scalar) move
+ * selection pass and the (wide) application and win-check passes.
+ */
+typedef struct {
+    int maskX[BATCH_GAMES];
+    int maskO[BATCH_GAMES];
+    int moveBit[BATCH_GAMES];  // Move chosen this ply, as a board bit
+    unsigned char done[BATCH_GAMES];
+    signed char result[BATCH_GAMES]; // +1 X won, -1 O won, 0 draw
+} GameBatch;
+
+/**
+ * @brief Picks the k-th set bit of a mask (k counted from 0).
+ */
+static int nthSetBit(int mask, int k) {
+    for (int pos = 0; pos < 9; pos++) {
+        if (mask & (1 << pos)) {
+            if (k == 0) return pos;
+            k--;
+        }
+    }
+    return -1; // Unreachable for k < countBits(mask)
+}
+
+/**
+ * @brief Move selection pass: stages one move bit per active game.
+ *
+ * Scalar by nature (tablebase lookup plus an RNG draw per game), but
+ * each lookup is a single array load, so this pass is still only a few
+ * nanoseconds per game. The move policy matches the real engine's: an
+ * immediate win is taken BEFORE the error roll (the user-visible AI
+ * never misses its own winning move, whatever its error rate), so an
+ * N% player here plays the same curve as an N% player in tournament.c.
+ *
+ * @param xToMove Nonzero when X is the side to move this ply
+ * @param errorRate Mover's 0-100 chance of playing a random empty cell
+ */
+static void selectMoves(GameBatch *batch, int xToMove, int errorRate,
+                        Rng *rng) {
+    for (int g = 0; g < BATCH_GAMES; g++) {
+        if (batch->done[g]) {
+            batch->moveBit[g] = 0;
+            continue;
+        }
+
+        int aiMask = xToMove ? batch->maskX[g] : batch->maskO[g];
+        int oppMask = xToMove ? batch->maskO[g] : batch->maskX[g];
+        int empty = ~(aiMask | oppMask) & 0x1FF;
+
+        // Tactical layer ahead of the error roll, as in the engine.
+        // (Blocks stay behind the roll there too, and the tablebase
+        // already plays them on the no-error path.)
+        int winPos = findImmediateWin(aiMask, oppMask);
+        if (winPos >= 0) {
+            batch->moveBit[g] = 1 << winPos;
+            continue;
+        }
+
+        int pick;
+        if (errorRate > 0 && rngRange(rng, 100) < errorRate) {
+            pick = nthSetBit(empty, rngRange(rng, countBits(empty)));
+        } else {
+            // All optimal moves, randomized like findBestMoveMinimax
+            int candidates = tablebaseLookup(aiMask, oppMask);
+            if (candidates == 0) candidates = empty; // Table miss guard
+            pick = nthSetBit(candidates, rngRange(rng, countBits(candidates)));
+        }
+        batch->moveBit[g] = 1 << pick;
+    }
+}
+
+/**
+ * @brief Wide passes: applies staged moves, then sweeps the win lines.
+ *
+ * Both loops are straight-line bitwise work over parallel arrays with
+ * no calls and no branches on game state inside the hot expressions,
+ * exactly the shape auto-vectorizers turn into SIMD. The win sweep
+ * tests all 8 WIN_MASKS lines against every game's mover mask.
+ *
+ * @param plies Plies played after this move lands (draw check at 9)
+ */
+static void applyAndScore(GameBatch *batch, int xToMove, int plies) {
+    int *mover = xToMove ? batch->maskX : batch->maskO;
+
+    // Move application: one OR per game across the whole batch
+    for (int g = 0; g < BATCH_GAMES; g++) {
+        mover[g] |= batch->moveBit[g];
+    }
+
+    // Win sweep: line-major, so the line mask is loop-invariant and the
+    // inner loop is a pure compare-and-accumulate over the batch
+    unsigned char won[BATCH_GAMES] = {0};
+    for (int i = 0; i < 8; i++) {
+        int line = WIN_MASKS[i];
+        for (int g = 0; g < BATCH_GAMES; g++) {
+            won[g] |= ((mover[g] & line) == line);
+        }
+    }
+
+    for (int g = 0; g < BATCH_GAMES; g++) {
+        if (batch->done[g]) continue;
+        if (won[g]) {
+            batch->done[g] = 1;
+            batch->result[g] = (signed char)(xToMove ? 1 : -1);
+        } else if (plies == 9) {
+            batch->done[g] = 1;
+            batch->result[g] = 0;
+        }
+    }
+}
+
+/**
+ * @brief Plays one full batch to completion and tallies the results.
+ *
+ * A batch is homogeneous - every game shares the same starter - so the
+ * side to move is a single flag per ply and the whole batch stays in
+ * lockstep. Callers alternate the starter between batches to keep the
+ * even start distribution the threaded simulation has.
+ *
+ * @param xStarts Nonzero when X opens every game of this batch
+ * @param xErrorRate X's error rate (O always plays OPP_ERROR_RATE)
+ */
+static void playBatch(int xStarts, int xErrorRate, Rng *rng, long *xWins,
+                      long *oWins, long *draws) {
+    GameBatch batch;
+    memset(&batch, 0, sizeof(batch));
+
+    for (int ply = 0; ply < 9; ply++) {
+        int xToMove = (ply % 2 == 0) ? xStarts : !xStarts;
+        int errorRate = xToMove ? xErrorRate : OPP_ERROR_RATE;
+
+        selectMoves(&batch, xToMove, errorRate, rng);
+        applyAndScore(&batch, xToMove, ply + 1);
+    }
+
+    for (int g = 0; g < BATCH_GAMES; g++) {
+        if (batch.result[g] > 0) (*xWins)++;
+        else if (batch.result[g] < 0) (*oWins)++;
+        else (*draws)++;
+    }
+}
+
+int main(void) {
+    uint64_t seed = (uint64_t)time(NULL);
+    Rng rng;
+    rngSeed(&rng, seed);
+
+    initMinimaxTablebase();
+
+    printf("================================================================\n");
+    printf("STRUCT-OF-ARRAYS BATCH SIMULATION\n");
+    printf("----------------------------------------------------------------\n");
+    printf("Batch width: %d games in lockstep (single thread)\n", BATCH_GAMES);
+    printf("Games per point: %d | Opponent O: %d%% error rate\n",
+           GAMES_PER_POINT, OPP_ERROR_RATE);
+    printf("Seed: %llu (re-run with this to reproduce)\n",
+           (unsigned long long)seed);
+    printf("================================================================\n\n");
+
+    // Correctness check: two perfect players can only ever draw
+    {
+        long xw = 0, ow = 0, dr = 0;
+        Rng checkRng;
+        rngSeed(&checkRng, seed ^ 0x5EEDC0DEULL);
+        // Temporarily a perfect opponent: both sides error-free
+        for (int b = 0; b < 1024 / BATCH_GAMES; b++) {
+            GameBatch batch;
+            memset(&batch, 0, sizeof(batch));
+            for (int ply = 0; ply < 9; ply++) {
+                selectMoves(&batch, ply % 2 == 0, 0, &checkRng);
+                applyAndScore(&batch, ply % 2 == 0, ply + 1);
+            }
+            for (int g = 0; g < BATCH_GAMES; g++) {
+                if (batch.result[g] > 0) xw++;
+                else if (batch.result[g] < 0) ow++;
+                else dr++;
+            }
+        }
+        printf("Sanity (perfect vs perfect, 1024 games): "
+               "%ld draws, %ld decisive %s\n\n",
+               dr, xw + ow, (xw + ow == 0) ? "[OK]" : "[FAIL]");
+    }
+
+    printf("%-14s %10s %10s %10s %14s\n",
+           "X error rate", "X wins", "O wins", "draws", "games/sec");
+    printf("----------------------------------------------------------------\n");
+
+    for (int xError = 0; xError <= 50; xError += 10) {
+        long xWins = 0, oWins = 0, draws = 0;
+        int batches = GAMES_PER_POINT / BATCH_GAMES;
+
+        clock_t start = clock();
+        for (int b = 0; b < batches; b++) {
+            // Alternate the opening side batch by batch
+            playBatch(b % 2 == 0, xError, &rng, &xWins, &oWins, &draws);
+        }
+        double seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+        long total = xWins + oWins + draws;
+        printf("%13d%% %9.2f%% %9.2f%% %9.2f%% %14.0f\n",
+               xError,
+               100.0 * xWins / total,
+               100.0 * oWins / total,
+               100.0 * draws / total,
+               (seconds > 0.0) ? total / seconds : 0.0);
+    }
+
+    printf("----------------------------------------------------------------\n");
+    printf("Starts alternate batch by batch, so each side opens half the games.\n");
+    return 0;
+}
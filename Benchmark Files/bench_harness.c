@@ -0,0 +1,142 @@
+/**
+ * @file bench_harness.c
+ * @brief Statistical micro-benchmark harness implementation
+ */
+
+#include "bench_harness.h"
+#include <stdlib.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+// ============================================================================
+// MONOTONIC TIMER
+// ============================================================================
+
+double bench_now(void) {
+#ifdef _WIN32
+    static LARGE_INTEGER freq = {0};
+    LARGE_INTEGER counter;
+    if (freq.QuadPart == 0) {
+        QueryPerformanceFrequency(&freq);
+    }
+    QueryPerformanceCounter(&counter);
+    return (double)counter.QuadPart / (double)freq.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+#endif
+}
+
+// ============================================================================
+// MEASUREMENT PROTOCOL
+// ============================================================================
+
+static FILE *g_csv_output = NULL;
+static int g_csv_header_written = 0;
+
+void bench_set_csv_output(FILE *csv) {
+    g_csv_output = csv;
+    g_csv_header_written = 0;
+}
+
+/** @brief qsort comparator for double samples. */
+static int compare_samples(const void *a, const void *b) {
+    double da = *(const double *)a, db = *(const double *)b;
+    if (da < db) return -1;
+    if (da > db) return 1;
+    return 0;
+}
+
+/** @brief Returns the sample at percentile p (0.0-1.0) of a sorted array. */
+static double percentile(const double *sorted, int n, double p) {
+    int index = (int)(p * (n - 1) + 0.5);
+    return sorted[index];
+}
+
+/**
+ * @brief Runs op back-to-back until the batch duration target is met,
+ *        doubling the iteration count each attempt.
+ *
+ * This keeps every recorded sample well above timer granularity without
+ * hard-coding per-benchmark loop counts (model moves are ~1000x faster
+ * than an unpruned array search).
+ */
+static int calibrate_iterations(BenchOp op, void *ctx) {
+    int iterations = 1;
+    for (;;) {
+        double start = bench_now();
+        for (int i = 0; i < iterations; i++) {
+            op(ctx);
+        }
+        double elapsed = bench_now() - start;
+
+        if (elapsed >= BENCH_MIN_BATCH_SECONDS) {
+            return iterations;
+        }
+        if (iterations > (1 << 28)) {
+            return iterations; // Safety cap for no-op-fast operations
+        }
+        iterations *= 2;
+    }
+}
+
+BenchResult bench_run(const char *name, BenchOp op, void *ctx) {
+    // 1. WARMUP: run unrecorded until the warmup budget is spent
+    double warmup_end = bench_now() + BENCH_WARMUP_SECONDS;
+    while (bench_now() < warmup_end) {
+        op(ctx);
+    }
+
+    // 2. CALIBRATION: size one sample batch
+    int iterations = calibrate_iterations(op, ctx);
+
+    // 3. MEASUREMENT: record per-operation time for each batch
+    double samples[BENCH_REPETITIONS];
+    double total = 0.0;
+    for (int rep = 0; rep < BENCH_REPETITIONS; rep++) {
+        double start = bench_now();
+        for (int i = 0; i < iterations; i++) {
+            op(ctx);
+        }
+        double per_op_ns = (bench_now() - start) * 1e9 / (double)iterations;
+        samples[rep] = per_op_ns;
+        total += per_op_ns;
+    }
+
+    qsort(samples, BENCH_REPETITIONS, sizeof(double), compare_samples);
+
+    BenchResult result;
+    result.name = name;
+    result.iterations = iterations;
+    result.repetitions = BENCH_REPETITIONS;
+    result.min_ns = samples[0];
+    result.median_ns = percentile(samples, BENCH_REPETITIONS, 0.5);
+    result.p90_ns = percentile(samples, BENCH_REPETITIONS, 0.9);
+    result.max_ns = samples[BENCH_REPETITIONS - 1];
+    result.mean_ns = total / BENCH_REPETITIONS;
+
+    // 4. REPORTING
+    printf("%-36s median %12.1f ns  (min %12.1f | p90 %12.1f | max %12.1f)  [%d x %d iters]\n",
+           result.name, result.median_ns, result.min_ns, result.p90_ns,
+           result.max_ns, result.repetitions, result.iterations);
+
+    if (g_csv_output != NULL) {
+        if (!g_csv_header_written) {
+            fprintf(g_csv_output,
+                    "name,iterations,repetitions,min_ns,median_ns,p90_ns,max_ns,mean_ns\n");
+            g_csv_header_written = 1;
+        }
+        fprintf(g_csv_output, "%s,%d,%d,%.1f,%.1f,%.1f,%.1f,%.1f\n",
+                result.name, result.iterations, result.repetitions,
+                result.min_ns, result.median_ns, result.p90_ns, result.max_ns,
+                result.mean_ns);
+        fflush(g_csv_output);
+    }
+
+    return result;
+}
@@ -0,0 +1,70 @@
+/**
+ * @file bench_harness.h
+ * @brief Statistical micro-benchmark harness for the benchmark suite
+ *
+ * Replaces raw clock() loops with a proper measurement protocol:
+ *   - monotonic high-resolution timer (QueryPerformanceCounter on
+ *     Windows, CLOCK_MONOTONIC elsewhere)
+ *   - warmup phase before any recorded sample
+ *   - automatic calibration of the per-batch iteration count so each
+ *     sample runs long enough to be above timer granularity
+ *   - repeated batches with min / median / p90 / max / mean reporting,
+ *     so regressions can be told apart from run-to-run noise
+ *   - optional CSV output for machine diffing between runs
+ */
+
+#ifndef BENCH_HARNESS_H
+#define BENCH_HARNESS_H
+
+#include <stdio.h>
+
+// Measurement protocol tuning
+#define BENCH_WARMUP_SECONDS 0.05     // Spent warming caches/branch predictors
+#define BENCH_MIN_BATCH_SECONDS 0.02  // Target duration of one sample batch
+#define BENCH_REPETITIONS 25          // Recorded sample batches per benchmark
+
+/**
+ * @brief One benchmarked operation. Called once per iteration.
+ *
+ * The context pointer carries whatever state the operation needs (board,
+ * symbol, ...) so the same wrapper can serve several registrations.
+ */
+typedef void (*BenchOp)(void *ctx);
+
+/**
+ * @struct BenchResult
+ * @brief Per-operation timing statistics, all in nanoseconds.
+ */
+typedef struct {
+    const char *name;
+    int iterations;   // Calibrated iterations per sample batch
+    int repetitions;  // Number of recorded batches
+    double min_ns;
+    double median_ns;
+    double p90_ns;
+    double max_ns;
+    double mean_ns;
+} BenchResult;
+
+/**
+ * @brief Reads the monotonic high-resolution clock, in seconds.
+ */
+double bench_now(void);
+
+/**
+ * @brief Directs CSV output to a stream (NULL disables it).
+ *
+ * The header row is written on the first result; one row follows per
+ * bench_run call so CI can diff runs mechanically.
+ */
+void bench_set_csv_output(FILE *csv);
+
+/**
+ * @brief Warms up, calibrates, measures and reports one operation.
+ *
+ * Prints a human-readable summary line, appends a CSV row if output is
+ * configured, and returns the statistics for further comparisons.
+ */
+BenchResult bench_run(const char *name, BenchOp op, void *ctx);
+
+#endif // BENCH_HARNESS_H
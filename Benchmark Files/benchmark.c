@@ -1,13 +1,15 @@
-// gcc -o benchmark benchmark.c benchmark_algorithms.c
-// ../Game_algorithms/Minimax.c ../Game_algorithms/minimax_utils.c
-// ../Game_algorithms/model_minimax.c -I../Game_algorithms -lm
+// gcc -o benchmark benchmark.c benchmark_algorithms.c bench_harness.c
+// ../Game_algorithms/Minimax.c ../Game_algorithms/minimax_utils.c ../Game_algorithms/rng.c
+// ../Game_algorithms/tablebase.c ../Game_algorithms/model_minimax.c
+// ../Game_algorithms/minimax_nxn.c -I../Game_algorithms -lm
 
 #include "benchmark_algorithms.h"
+#include "bench_harness.h"
 #include "minimax.h"
+#include "minimax_nxn.h"
 #include "model_minimax.h"
 #include <stdio.h>
 #include <stdlib.h>
-#include <time.h>
 #include <stdbool.h>
 
 // ============================================================================
@@ -55,119 +57,147 @@ size_t get_measured_stack_usage() {
  */
 void track_stack_usage() {
     if (!g_stack_tracker.enabled) return;
-    
+
     void* current_stack;
     size_t used = (size_t)((char*)g_stack_tracker.stack_base - (char*)&current_stack);
-    
+
     if (used > g_stack_tracker.max_stack_used) {
         g_stack_tracker.max_stack_used = used;
     }
 }
 
+// ============================================================================
+// REGISTERED BENCHMARK OPERATIONS
+// ============================================================================
+
+// Empty board (worst case for search); shared by every operation.
+static char g_bench_board[3][3] = {{' ', ' ', ' '}, {' ', ' ', ' '}, {' ', ' ', ' '}};
+
+// Sink keeps the compiler from discarding the benchmarked calls.
+static volatile int g_bench_sink = 0;
+
+static void op_model_move(void *ctx) {
+    (void)ctx;
+    struct Move move = findBestMoveModel(g_bench_board, 'X');
+    g_bench_sink = move.row;
+}
+
+static void op_minimax_imperfect(void *ctx) {
+    (void)ctx;
+    struct Move move = findBestMoveMinimax(g_bench_board, 'X', 20);
+    g_bench_sink = move.row;
+}
+
+static void op_minimax_perfect(void *ctx) {
+    (void)ctx;
+    struct Move move = findBestMoveMinimax(g_bench_board, 'X', 0);
+    g_bench_sink = move.row;
+}
+
+static void op_array_no_pruning(void *ctx) {
+    (void)ctx;
+    struct Move move = findBestMoveMinimax_NoBitboard_NoPruning(g_bench_board, 'X');
+    g_bench_sink = move.row;
+}
+
+static void op_array_alpha_beta(void *ctx) {
+    (void)ctx;
+    struct Move move = findBestMoveMinimax_NoBitboard(g_bench_board, 'X', 0);
+    g_bench_sink = move.row;
+}
+
+static void op_bitboard_alpha_beta(void *ctx) {
+    (void)ctx;
+    struct Move move = findBestMoveMinimax_Bitboard(g_bench_board, 'X');
+    g_bench_sink = move.row;
+}
+
+// 5x5 four-in-a-row engine for the NxN memory/timing section
+static EngineNxN g_nxn_engine;
+
+static void op_nxn_5x5_depth6(void *ctx) {
+    (void)ctx;
+    struct Move move = findBestMoveMinimaxNxN(&g_nxn_engine, 0, 0, 6);
+    g_bench_sink = move.row;
+}
+
+/** @brief Prints a median-based speedup line between two results. */
+static void print_speedup(const char *label, BenchResult slow, BenchResult fast) {
+    if (fast.median_ns > 0.0) {
+        printf("%s: %.2fx (median %0.1f ns vs %0.1f ns)\n",
+               label, slow.median_ns / fast.median_ns,
+               slow.median_ns, fast.median_ns);
+    } else {
+        printf("%s: too fast to measure accurately\n", label);
+    }
+}
+
 int main() {
   printf("==================================================\n");
   printf("TIC-TAC-TOE AI BENCHMARK SUITE\n");
   printf("==================================================\n");
-  printf("Running all benchmarks...\n");
+  printf("Protocol: %.0f ms warmup, calibrated batches,\n",
+         BENCH_WARMUP_SECONDS * 1000.0);
+  printf("%d repetitions per benchmark, median/percentile stats\n",
+         BENCH_REPETITIONS);
   printf("==================================================\n\n");
 
-  // Setup Empty Board (Worst Case for Search)
-  char board[3][3] = {{' ', ' ', ' '}, {' ', ' ', ' '}, {' ', ' ', ' '}};
-  struct Move move;
-  clock_t start, end;
-  double cpu_time_1, cpu_time_2;
-
-  int iterations = 1000;     // For optimization benchmarks
-  int ai_iterations = 10000; // For AI difficulty benchmarks
+  // CSV output for CI diffing between runs
+  FILE *csv = fopen("benchmark_results.csv", "w");
+  if (csv != NULL) {
+      bench_set_csv_output(csv);
+  } else {
+      printf("WARNING: could not open benchmark_results.csv, CSV output disabled\n\n");
+  }
 
   // ====================================================================
   // PART 1: AI DIFFICULTY BENCHMARKS
   // ====================================================================
-  printf("\n");
   printf("##################################################\n");
   printf("PART 1: AI DIFFICULTY BENCHMARKS\n");
-  printf("##################################################\n");
-  printf("Testing different AI difficulty levels\n");
-  printf("Iterations: %d\n\n", ai_iterations);
-
-  // TEST 1: LOGISTIC REGRESSION (EASY / MODEL)
-  printf("Testing Easy Mode (Logistic Regression AI Model)...\n");
-  start = clock();
-  for (int i = 0; i < ai_iterations; i++) {
-    move = findBestMoveModel(board, 'X');
-  }
-  end = clock();
-  double time_easy = ((double)(end - start)) / CLOCKS_PER_SEC;
-
-  // Memory analysis for Easy mode
-  int easy_frame_size = sizeof(int) * 3 + sizeof(double) * 9;  // Simple iterative function
-  
-  printf("\n");
-  printf("========================================\n");
-  printf("RESULTS: Easy Mode (Logistic Regression AI Model)\n");
-  printf("========================================\n\n");
-  printf("Best Move: (%d, %d)\n", move.row, move.col);
-  printf("Total Time (%d runs): %.6f s\n", ai_iterations, time_easy);
-  printf("Avg Time per Move: %.8f s\n", time_easy / ai_iterations);
-  printf("========================================\n\n");
-
-  // TEST 2: MINIMAX BITBOARD (MEDIUM / IMPERFECT)
-  printf("Testing Medium Mode (Imperfect Minimax AI)...\n");
-  
-  // Calibrate stack usage
+  printf("##################################################\n\n");
+
+  // Calibrate stack usage and search stats once per minimax mode
+  // (tracking adds overhead, so it stays out of the timed runs). The
+  // node probe samples the C stack at every search node - without it
+  // the tracker never fires inside the production engine.
+  SearchStats medium_stats, hard_stats;
+
+  // Each calibration starts from a cold transposition table; otherwise
+  // the hard run would be answered from the table the medium run just
+  // filled and its stats would describe the cache, not the search.
+  minimaxClearTT();
+  minimaxAttachStats(&medium_stats);
+  minimaxAttachNodeProbe(track_stack_usage);
   enable_stack_tracking();
-  g_max_depth_reached = 0;
-  move = findBestMoveMinimax(board, 'X', 20);
+  (void)findBestMoveMinimax(g_bench_board, 'X', 20);
   size_t medium_stack = get_measured_stack_usage();
-  int medium_depth = g_max_depth_reached;
   disable_stack_tracking();
-  
-  // Run timing benchmarks
-  g_max_depth_reached = 0;
-  start = clock();
-  for (int i = 0; i < ai_iterations; i++) {
-    move = findBestMoveMinimax(board, 'X', 20);
-  }
-  end = clock();
-  double time_medium = ((double)(end - start)) / CLOCKS_PER_SEC;
-  
-  printf("\n");
-  printf("========================================\n");
-  printf("RESULTS: Medium Mode (Imperfect Minimax AI)\n");
-  printf("========================================\n\n");
-  printf("Best Move: (%d, %d)\n", move.row, move.col);
-  printf("Total Time (%d runs): %.6f s\n", ai_iterations, time_medium);
-  printf("Avg Time per Move: %.8f s\n", time_medium / ai_iterations);
-  printf("========================================\n\n");
-
-  // TEST 3: MINIMAX BITBOARD (HARD / PERFECT)
-  printf("Testing Hard Mode (Perfect Minimax AI)...\n");
-  
-  // Calibrate stack usage
+
+  minimaxClearTT();
+  minimaxAttachStats(&hard_stats);
   enable_stack_tracking();
-  g_max_depth_reached = 0;
-  move = findBestMoveMinimax(board, 'X', 0);
+  (void)findBestMoveMinimax(g_bench_board, 'X', 0);
   size_t hard_stack = get_measured_stack_usage();
-  int hard_depth = g_max_depth_reached;
   disable_stack_tracking();
-  
-  // Run timing benchmarks
-  g_max_depth_reached = 0;
-  start = clock();
-  for (int i = 0; i < ai_iterations; i++) {
-    move = findBestMoveMinimax(board, 'X', 0);
-  }
-  end = clock();
-  double time_hard = ((double)(end - start)) / CLOCKS_PER_SEC;
-  
-  printf("\n");
-  printf("========================================\n");
-  printf("RESULTS: Hard Mode (Perfect Minimax AI)\n");
-  printf("========================================\n\n");
-  printf("Best Move: (%d, %d)\n", move.row, move.col);
-  printf("Total Time (%d runs): %.6f s\n", ai_iterations, time_hard);
-  printf("Avg Time per Move: %.8f s\n", time_hard / ai_iterations);
-  printf("========================================\n\n");
+  minimaxAttachNodeProbe(NULL);
+
+  minimaxAttachStats(NULL); // Keep the timed runs uninstrumented
+
+  bench_run("easy_model_move", op_model_move, NULL);
+  bench_run("medium_minimax_move", op_minimax_imperfect, NULL);
+  bench_run("hard_minimax_move", op_minimax_perfect, NULL);
+
+  printf("\nMedium mode: measured stack %zu bytes\n", medium_stack);
+  printf("  search: %ld nodes, %ld terminals, %ld tt hits, %ld cutoffs, "
+         "max depth %d, %.3f ms\n",
+         medium_stats.nodes, medium_stats.terminals, medium_stats.ttHits,
+         medium_stats.cutoffs, medium_stats.maxDepth, medium_stats.elapsedMs);
+  printf("Hard mode:   measured stack %zu bytes\n", hard_stack);
+  printf("  search: %ld nodes, %ld terminals, %ld tt hits, %ld cutoffs, "
+         "max depth %d, %.3f ms\n",
+         hard_stats.nodes, hard_stats.terminals, hard_stats.ttHits,
+         hard_stats.cutoffs, hard_stats.maxDepth, hard_stats.elapsedMs);
 
   // ====================================================================
   // PART 2: MINIMAX OPTIMIZATION BENCHMARKS
@@ -175,296 +205,96 @@ int main() {
   printf("\n\n");
   printf("##################################################\n");
   printf("PART 2: MINIMAX OPTIMIZATION BENCHMARKS\n");
-  printf("##################################################\n");
-  printf("Comparing different Minimax implementations\n");
-  printf("Iterations: %d\n\n", iterations);
+  printf("##################################################\n\n");
 
-  // ====================================================================
-  // BENCHMARK 1: ARRAY (NO OPTIMISATIONS) vs ARRAY (ALPHA-BETA)
-  // ====================================================================
-  printf("\n");
-  printf("--------------------------------------------------\n");
-  printf("BENCHMARK 1: Algorithmic Optimization Impact\n");
-  printf("--------------------------------------------------\n");
-  printf("Comparing: Minimax Array (No Optimisations) vs Minimax Array "
-         "(Alpha-Beta)\n\n");
-
-  // DYNAMIC MEMORY MEASUREMENT
+  // MEMORY ANALYSIS (single instrumented run per implementation)
   printf("=== MEMORY ANALYSIS ===\n");
-  printf("Measuring actual stack usage...\n");
-  
-  // Calibrate without alpha-beta
+
   enable_stack_tracking();
-  move = findBestMoveMinimax_NoBitboard_NoPruning(board, 'X');
+  (void)findBestMoveMinimax_NoBitboard_NoPruning(g_bench_board, 'X');
   size_t stack_no_ab = get_measured_stack_usage();
   disable_stack_tracking();
-  
-  // Calibrate with alpha-beta
+
   enable_stack_tracking();
-  move = findBestMoveMinimax_NoBitboard(board, 'X', 0);
+  (void)findBestMoveMinimax_NoBitboard(g_bench_board, 'X', 0);
   size_t stack_with_ab = get_measured_stack_usage();
   disable_stack_tracking();
-  
-  printf("\nWithout Alpha-Beta:\n");
-  printf("  Measured stack usage: %zu bytes\n", stack_no_ab);
-  printf("  Typical max depth: 9 levels (full tree)\n");
-  printf("  Frame size: ~%zu bytes\n\n", stack_no_ab / 9);
-  
-  printf("With Alpha-Beta:\n");
-  printf("  Measured stack usage: %zu bytes\n", stack_with_ab);
-  printf("  Typical max depth: 5 levels (pruned tree)\n");
-  printf("  Frame size: ~%zu bytes\n", stack_with_ab / 5);
-  
-  long long diff = (long long)stack_no_ab - (long long)stack_with_ab;
-  if (diff >= 0) {
-      printf("  Memory saved: %lld bytes (%.1f%% reduction)\n\n",
-             diff, 100.0 * (float)diff / (float)stack_no_ab);
-  } else {
-      printf("  Memory impact: %+lld bytes (%.1f%% increase)\n",
-             diff, 100.0 * (float)(-diff) / (float)stack_no_ab);
-  }
-  
-  printf("=======================\n\n");
-
-
-  // TEST A: Minimax Array (No Optimisations)
-  printf("Testing Minimax Array (No Optimisations)...\n");
-  start = clock();
-  for (int i = 0; i < iterations; i++) {
-    move = findBestMoveMinimax_NoBitboard_NoPruning(board, 'X');
-  }
-  end = clock();
-  cpu_time_1 = ((double)(end - start)) / CLOCKS_PER_SEC;
-  double avg_time_1_b1 = cpu_time_1 / iterations;
-
-  // TEST B: Minimax Array (Alpha-Beta)
-  printf("Testing Minimax Array (Alpha-Beta)...\n");
-  start = clock();
-  for (int i = 0; i < iterations; i++) {
-    move = findBestMoveMinimax_NoBitboard(board, 'X', 0);
-  }
-  end = clock();
-  cpu_time_2 = ((double)(end - start)) / CLOCKS_PER_SEC;
-  double avg_time_2_b1 = cpu_time_2 / iterations;
-
-  printf("\n");
-  printf("========================================\n");
-  printf("RESULTS:\n");
-  printf("========================================\n\n");
-
-  printf("Minimax Array (No Optimisations):\n");
-  printf("  Avg Time per Move: %.6f s\n\n", avg_time_1_b1);
-
-  printf("Minimax Array (Alpha-Beta):\n");
-  printf("  Avg Time per Move: %.6f s\n\n", avg_time_2_b1);
-
-  if (avg_time_2_b1 > 0.0) {
-    printf("SPEEDUP: %.2fx Faster with Alpha-Beta Pruning\n",
-           avg_time_1_b1 / avg_time_2_b1);
-  } else {
-    printf("SPEEDUP: Too fast to measure accurately\n");
-  }
-  printf("========================================\n");
 
-  // ====================================================================
-  // BENCHMARK 2: BITBOARD (ALPHA-BETA) vs ARRAY (ALPHA-BETA)
-  // ====================================================================
-  printf("\n\n");
-  printf("--------------------------------------------------\n");
-  printf("BENCHMARK 2: Data Structure Efficiency\n");
-  printf("--------------------------------------------------\n");
-  printf("Comparing: Minimax Bitboard (Alpha-Beta) vs Minimax Array "
-         "(Alpha-Beta)\n\n");
-
-  // MEMORY CALIBRATION
-  printf("=== MEMORY ANALYSIS ===\n");
-  printf("Calibrating stack usage...\n");
-  
-  // Calculate state sizes (portable via sizeof)
-  size_t state_bitboard = sizeof(int) * 2;
-  size_t state_array = sizeof(char) * 9;
-  
-  // Calibrate bitboard
   enable_stack_tracking();
-  move = findBestMoveMinimax_Bitboard(board, 'X');
+  (void)findBestMoveMinimax_Bitboard(g_bench_board, 'X');
   size_t stack_bitboard = get_measured_stack_usage();
   disable_stack_tracking();
-  
-  // Calibrate array
-  enable_stack_tracking();
-  move = findBestMoveMinimax_NoBitboard(board, 'X', 0);
-  size_t stack_array = get_measured_stack_usage();
-  disable_stack_tracking();
-  
-  printf("\nBitboard representation:\n");
-  printf("  State size: %zu bytes (2 x int)\n", state_bitboard);
-  printf("  Frame size: ~%zu bytes\n", stack_bitboard / 5);
-  printf("  Measured stack usage: %zu bytes (5 x %zu)\n\n", 
-         stack_bitboard, stack_bitboard / 5);
-  
-  printf("Array representation:\n");
-  printf("  State size: %zu bytes (9 x char)\n", state_array);
-  printf("  Frame size: ~%zu bytes\n", stack_array / 5);
-  printf("  Measured stack usage: %zu bytes (5 x %zu)\n\n",
-         stack_array, stack_array / 5);
-  
-  printf("Comparison:\n");
-  printf("  State memory saved: %zu byte (%.1f%% reduction)\n",
-         state_array - state_bitboard,
-         100.0 * (float)(state_array - state_bitboard) / (float)state_array);
-  printf("  Stack memory saved: %d bytes (%.1f%% reduction)\n",
-         (int)(stack_array - stack_bitboard),
-         100.0 * (float)(stack_array - stack_bitboard) / (float)stack_array);
-  printf("=======================\n\n");
 
-  // TEST A: Minimax Bitboard (Alpha-Beta)
-  printf("Testing Minimax Bitboard (Alpha-Beta)...\n");
-  start = clock();
-  for (int i = 0; i < iterations; i++) {
-    move = findBestMoveMinimax(board, 'X', 0);
+  printf("Array (no pruning):   state %zu bytes, measured stack %zu bytes\n",
+         sizeof(char) * 9, stack_no_ab);
+  printf("Array (alpha-beta):   state %zu bytes, measured stack %zu bytes\n",
+         sizeof(char) * 9, stack_with_ab);
+  printf("Bitboard (alpha-beta): state %zu bytes, measured stack %zu bytes\n",
+         sizeof(int) * 2, stack_bitboard);
+
+  long long ab_saved = (long long)stack_no_ab - (long long)stack_with_ab;
+  if (stack_no_ab > 0) {
+      printf("Alpha-beta stack delta: %+lld bytes (%.1f%%)\n",
+             -ab_saved, -100.0 * (double)ab_saved / (double)stack_no_ab);
   }
-  end = clock();
-  cpu_time_1 = ((double)(end - start)) / CLOCKS_PER_SEC;
-  double avg_time_1_b2 = cpu_time_1 / iterations;
-
-  // TEST B: Minimax Array (Alpha-Beta)
-  printf("Testing Minimax Array (Alpha-Beta)...\n");
-  start = clock();
-  for (int i = 0; i < iterations; i++) {
-    move = findBestMoveMinimax_NoBitboard(board, 'X', 0);
-  }
-  end = clock();
-  cpu_time_2 = ((double)(end - start)) / CLOCKS_PER_SEC;
-  double avg_time_2_b2 = cpu_time_2 / iterations;
+  printf("=======================\n\n");
+
+  // TIMING: all three implementations as registered benchmarks
+  BenchResult res_no_ab = bench_run("array_no_pruning", op_array_no_pruning, NULL);
+  BenchResult res_array_ab = bench_run("array_alpha_beta", op_array_alpha_beta, NULL);
+  BenchResult res_bitboard = bench_run("bitboard_alpha_beta", op_bitboard_alpha_beta, NULL);
 
   printf("\n");
   printf("========================================\n");
-  printf("RESULTS:\n");
-  printf("========================================\n\n");
-
-  printf("Minimax Bitboard (Alpha-Beta):\n");
-  printf("  State Memory Size: %zu bytes\n", sizeof(int) * 2);
-  printf("  Avg Time per Move: %.6f s\n\n", avg_time_1_b2);
-
-  printf("Minimax Array (Alpha-Beta):\n");
-  printf("  State Memory Size: %zu bytes\n", sizeof(char) * 9);
-  printf("  Avg Time per Move: %.6f s\n\n", avg_time_2_b2);
-
-  if (cpu_time_1 < cpu_time_2) {
-    if (avg_time_1_b2 > 0.0)
-      printf("SPEEDUP: %.2fx (Bitboard is Faster)\n", avg_time_2_b2 / avg_time_1_b2);
-    else
-      printf("SPEEDUP: Too fast to measure accurately\n");
-  } else {
-    if (avg_time_2_b2 > 0.0)
-      printf("SPEEDUP: %.2fx (Array is Faster)\n", avg_time_1_b2 / avg_time_2_b2);
-    else
-      printf("SPEEDUP: Too fast to measure accurately\n");
-  }
-
+  printf("SPEEDUP SUMMARY (median-based)\n");
+  printf("========================================\n");
+  print_speedup("Alpha-beta vs no pruning (array)", res_no_ab, res_array_ab);
+  print_speedup("Bitboard vs array (alpha-beta)  ", res_array_ab, res_bitboard);
+  print_speedup("Fully optimized vs baseline     ", res_no_ab, res_bitboard);
   printf("========================================\n");
 
   // ====================================================================
-  // BENCHMARK 3: BITBOARD (ALPHA-BETA) vs ARRAY (NO OPTIMISATIONS)
+  // PART 3: NXN ITERATIVE ENGINE MEMORY
   // ====================================================================
   printf("\n\n");
-  printf("--------------------------------------------------\n");
-  printf("BENCHMARK 3: Maximum Performance Comparison\n");
-  printf("--------------------------------------------------\n");
-  printf("Comparing: Minimax Bitboard (Alpha-Beta) vs Minimax Array (No "
-         "Optimisations)\n\n");
-
-  // DYNAMIC MEMORY MEASUREMENT
-  printf("=== MEMORY ANALYSIS ===\n");
-  printf("Measuring actual stack usage...\n");
-  
-  // Calibrate optimized (bitboard + alpha-beta)
-  enable_stack_tracking();
-  move = findBestMoveMinimax_Bitboard(board, 'X');
-  size_t stack_optimized = get_measured_stack_usage();
-  disable_stack_tracking();
-  
-  // Calibrate baseline (array, no alpha-beta)
-  enable_stack_tracking();
-  move = findBestMoveMinimax_NoBitboard_NoPruning(board, 'X');
-  size_t stack_baseline = get_measured_stack_usage();
-  disable_stack_tracking();
-  
-  size_t state_optimized = sizeof(int) * 2;
-  size_t state_baseline = sizeof(char) * 9;
-  
-  printf("\nFully Optimized (Bitboard + Alpha-Beta):\n");
-  printf("  State size: %zu bytes (2 x int)\n", state_optimized);
-  printf("  Frame size: ~%zu bytes\n", stack_optimized / 5);
-  printf("  Typical max depth: 5 levels\n");
-  printf("  Measured stack usage: %zu bytes (5 x %zu)\n\n",
-         stack_optimized, stack_optimized / 5);
-  
-  printf("Baseline (Array, No Optimizations):\n");
-  printf("  State size: %zu bytes (9 x char)\n", state_baseline);
-  printf("  Frame size: ~%zu bytes\n", stack_baseline / 9);
-  printf("  Typical max depth: 9 levels\n");
-  printf("  Measured stack usage: %zu bytes (9 x %zu)\n\n",
-         stack_baseline, stack_baseline / 9);
-  
-  printf("Total Improvement:\n");
-  printf("  State memory saved: %zu bytes (%.1f%% reduction)\n",
-         state_baseline - state_optimized,
-         100.0 * (float)(state_baseline - state_optimized) / (float)state_baseline);
-          
-  long long stack_diff = (long long)stack_baseline - (long long)stack_optimized;
-  if (stack_diff >= 0) {
-      printf("  Stack memory saved: %lld bytes (%.1f%% reduction)\n",
-             stack_diff, 100.0 * (float)stack_diff / (float)stack_baseline);
-  } else {
-      printf("  Stack memory impact: %+lld bytes (%.1f%% increase)\n",
-             stack_diff, 100.0 * (float)(-stack_diff) / (float)stack_baseline);
-  }
-  printf("=======================\n\n");
-
-  // TEST A: Minimax Bitboard (Alpha-Beta)
-  printf("Testing Minimax Bitboard (Alpha-Beta)...\n");
-  start = clock();
-  for (int i = 0; i < iterations; i++) {
-    move = findBestMoveMinimax(board, 'X', 0);
-  }
-  end = clock();
-  cpu_time_1 = ((double)(end - start)) / CLOCKS_PER_SEC;
-  double avg_time_1_b3 = cpu_time_1 / iterations;
-
-  // TEST B: Minimax Array (No Optimisations)
-  printf("Testing Minimax Array (No Optimisations)...\n");
-  start = clock();
-  for (int i = 0; i < iterations; i++) {
-    move = findBestMoveMinimax_NoBitboard_NoPruning(board, 'X');
+  printf("##################################################\n");
+  printf("PART 3: NXN ITERATIVE ENGINE MEMORY\n");
+  printf("##################################################\n\n");
+
+  // The NxN search keeps its frames in a static array instead of
+  // recursing, so the C stack it consumes should stay flat no matter
+  // how deep the search goes. The node probe samples the C stack at
+  // every expanded node, the same calibration the recursive engines get.
+  initEngineNxN(&g_nxn_engine, 5, 4);
+
+  printf("=== MEMORY ANALYSIS (5x5, 4-in-a-row, empty board) ===\n");
+  for (int depth = 4; depth <= 10; depth += 3) {
+      nxnAttachNodeProbe(track_stack_usage);
+      enable_stack_tracking();
+      (void)findBestMoveMinimaxNxN(&g_nxn_engine, 0, 0, depth);
+      size_t cStack = get_measured_stack_usage();
+      disable_stack_tracking();
+      nxnAttachNodeProbe(NULL);
+
+      printf("depth %2d: measured C stack %zu bytes, "
+             "explicit frames peak %d\n",
+             depth, cStack, nxnSearchPeakFrames());
   }
-  end = clock();
-  cpu_time_2 = ((double)(end - start)) / CLOCKS_PER_SEC;
-  double avg_time_2_b3 = cpu_time_2 / iterations;
-
-  printf("\n");
-  printf("========================================\n");
-  printf("RESULTS:\n");
-  printf("========================================\n\n");
+  printf("Explicit frame stack capacity: %zu bytes "
+         "(%d frames, fixed at compile time)\n",
+         nxnSearchStackBytes(), NXN_SEARCH_MAX_FRAMES);
+  printf("=======================================================\n\n");
 
-  printf("Minimax Bitboard (Alpha-Beta):\n");
-  printf("  Avg Time per Move: %.6f s\n\n", avg_time_1_b3);
-
-  printf("Minimax Array (No Optimisations):\n");
-  printf("  Avg Time per Move: %.6f s\n\n", avg_time_2_b3);
-
-  if (avg_time_1_b3 > 0.0) {
-    printf("SPEEDUP: %.2fx (Fastest vs Slowest Implementation)\n",
-           avg_time_2_b3 / avg_time_1_b3);
-  } else {
-    printf("SPEEDUP: Too fast to measure accurately\n");
-  }
-  printf("========================================\n");
+  bench_run("nxn_5x5_depth6", op_nxn_5x5_depth6, NULL);
 
   // Final summary
   printf("\n\n");
   printf("==================================================\n");
   printf("ALL BENCHMARKS COMPLETE\n");
+  if (csv != NULL) {
+      printf("Results written to benchmark_results.csv\n");
+      fclose(csv);
+  }
   printf("==================================================\n");
 
   return 0;
@@ -19,8 +19,6 @@
 // External declaration for stack tracking (defined in benchmark.c)
 extern void track_stack_usage(void);
 
-// Reuse the same benchmarking globals from minimax.c
-extern int g_max_depth_reached;
 
 // ============================================================================
 // HELPER FUNCTIONS (ARRAY BASED)
@@ -281,11 +279,6 @@ static int minimax_masks_no_pruning(int playerMask, int oppMask, int depth,
   // Track stack usage for calibration (zero overhead when disabled)
   track_stack_usage();
   
-  // Track max depth for benchmarking
-  if (depth > g_max_depth_reached) {
-    g_max_depth_reached = depth;
-  }
-
   // 1. TERMINAL STATE CHECKS
   if (isWinnerMask(playerMask))
     return 10 - depth;
@@ -367,11 +360,6 @@ static int minimax_masks_with_alphabeta(int playerMask, int oppMask, int depth,
   // Track stack usage for calibration (zero overhead when disabled)
   track_stack_usage();
   
-  // Track max depth for benchmarking
-  if (depth > g_max_depth_reached) {
-    g_max_depth_reached = depth;
-  }
-
   // Terminal state checks
   if (isWinnerMask(playerMask))
     return 10 - depth;
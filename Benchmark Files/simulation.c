@@ -2,55 +2,81 @@
  * @file simulation.c
  * @brief Benchmark simulation for AI difficulty modes
  *
-
+ * Games are sharded across a worker pool (one thread per core) and each
+ * game is scored through a re-entrant bitboard path, so no thread ever
+ * touches the global GameState from GUI_handlers/game_state.c.
  *
  * COMPILATION:
- * gcc -o "Benchmark Files\simulation.exe" "Benchmark Files\simulation.c" "GUI_handlers\game_state.c" "Game_algorithms\Minimax.c" "Game_algorithms\model_minimax.c" "Game_algorithms\minimax_utils.c" -Ilib\raylib -Llib\raylib -lraylib -lopengl32 -lgdi32 -lwinmm -static -lm
+ * gcc -o "Benchmark Files\simulation.exe" "Benchmark Files\simulation.c" "Game_algorithms\Minimax.c" "Game_algorithms\model_minimax.c" "Game_algorithms\minimax_utils.c" "Game_algorithms\rng.c" "Game_algorithms\tablebase.c" -I"Game_algorithms" -pthread -static -lm
  */
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <time.h>
-#include "../GUI_handlers/game_state.h"
+#include <pthread.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
 #include "../Game_algorithms/minimax.h"
+#include "../Game_algorithms/minimax_utils.h"
 #include "../Game_algorithms/model_minimax.h"
+#include "../Game_algorithms/tablebase.h"
 
 // Configuration
 #define NUM_GAMES 10000  // Must be even for equal start distribution
+#define MAX_THREADS 64
 #define TEST_AI_SYMBOL 'X'
 #define BENCHMARK_AI_SYMBOL 'O'
 
+/**
+ * @brief Returns the number of available CPU cores (at least 1).
+ */
+static int detect_core_count(void) {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    int cores = (int)info.dwNumberOfProcessors;
+#else
+    int cores = (int)sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+    if (cores < 1) cores = 1;
+    if (cores > MAX_THREADS) cores = MAX_THREADS;
+    return cores;
+}
+
 /**
  * @brief Play a single game between Test AI and Benchmark AI
- * 
+ *
+ * Fully re-entrant: the board lives on this thread's stack and the
+ * result is decided from local bitboard masks via isWinnerMask, not the
+ * global game.winner field, so any number of games can run concurrently.
+ *
  * @param test_ai_mode 1=Perfect, 2=Imperfect, 3=Model
  * @param test_ai_starts 1 if Test AI (X) moves first, 0 if Benchmark AI (O) moves first
+ * @param rng This worker's generator (error rolls and tie-breaks)
  * @return 1 if Test AI wins, -1 if Benchmark AI wins, 0 for Draw
  */
-int play_game(int test_ai_mode, int test_ai_starts) {
-    // Initialize local board copy to prevent state leakage
+int play_game(int test_ai_mode, int test_ai_starts, Rng *rng) {
+    // Local board - no state leaks between games or threads
     char board[3][3];
-    
-    // Clear the board manually
     for(int r=0; r<3; r++) {
         for(int c=0; c<3; c++) {
             board[r][c] = ' ';
         }
     }
-    
-    // Save and reset global game winner for this game context
-    char savedWinner = game.winner;
-    game.winner = ' ';
-    
+
+    // Local bitboard masks, updated incrementally as moves land
+    int maskX = 0, maskO = 0;
+
     // Determine who moves first based on the function argument
     char current_turn = test_ai_starts ? TEST_AI_SYMBOL : BENCHMARK_AI_SYMBOL;
-    
-    // Loop until game over (Win or Draw)
-    // CheckWinner returns true if there is a winner and sets game.winner
-    // IsBoardFull returns true if draw and sets game.winner = ' '
-    while (!CheckWinner(board) && !IsBoardFull(board)) {
+
+    // Loop until game over (win detected on the mover's mask, or board full)
+    for (int plies = 0; plies < 9; plies++) {
         struct Move move = {-1, -1};
-        
+
         // Create a temporary board for AI functions (preserves original board safety)
         char tempBoard[3][3];
         for(int r=0; r<3; r++) {
@@ -62,9 +88,9 @@ int play_game(int test_ai_mode, int test_ai_starts) {
         if (current_turn == TEST_AI_SYMBOL) {
             // --- TEST AI TURN (Playing as X) ---
             if (test_ai_mode == 1) {
-                move = findBestMoveMinimax(tempBoard, TEST_AI_SYMBOL, 0);
+                move = findBestMoveMinimaxRng(tempBoard, TEST_AI_SYMBOL, 0, rng);
             } else if (test_ai_mode == 2) {
-                move = findBestMoveMinimax(tempBoard, TEST_AI_SYMBOL, 20);
+                move = findBestMoveMinimaxRng(tempBoard, TEST_AI_SYMBOL, 20, rng);
             } else if (test_ai_mode == 3) {
                 // Model AI with proper symbol support
                 move = findBestMoveModel(tempBoard, TEST_AI_SYMBOL);
@@ -72,48 +98,99 @@ int play_game(int test_ai_mode, int test_ai_starts) {
         } else {
             // --- BENCHMARK AI TURN (Playing as O) ---
             // Uses Imperfect AI with 10% chance of play error as the benchmark
-            move = findBestMoveMinimax(tempBoard, BENCHMARK_AI_SYMBOL, 10);
+            move = findBestMoveMinimaxRng(tempBoard, BENCHMARK_AI_SYMBOL, 10, rng);
         }
-        
+
         // Apply the move
-        if (move.row >= 0 && move.row < 3 && move.col >= 0 && move.col < 3 && board[move.row][move.col] == ' ') {
-            board[move.row][move.col] = current_turn;
-        } else {
+        if (!(move.row >= 0 && move.row < 3 && move.col >= 0 && move.col < 3
+              && board[move.row][move.col] == ' ')) {
             // Fallback for invalid moves (fills first empty slot)
-            int found = 0;
-            for (int r = 0; r < 3 && !found; r++) {
+            move.row = -1;
+            for (int r = 0; r < 3 && move.row < 0; r++) {
                 for (int c = 0; c < 3; c++) {
                     if (board[r][c] == ' ') {
-                        board[r][c] = current_turn;
-                        found = 1;
+                        move.row = r;
+                        move.col = c;
                         break;
                     }
                 }
             }
         }
-        
+
+        board[move.row][move.col] = current_turn;
+        int bit = 1 << (move.row * 3 + move.col);
+        if (current_turn == 'X') maskX |= bit;
+        else maskO |= bit;
+
+        // Only the player who just moved can have completed a line
+        if (current_turn == 'X' && isWinnerMask(maskX)) {
+            return (TEST_AI_SYMBOL == 'X') ? 1 : -1;
+        }
+        if (current_turn == 'O' && isWinnerMask(maskO)) {
+            return (TEST_AI_SYMBOL == 'O') ? 1 : -1;
+        }
+
         // Switch turn
         current_turn = (current_turn == 'X') ? 'O' : 'X';
     }
-    
-    // Determine Result based on game.winner set by CheckWinner/IsBoardFull
-    int result;
-    if (game.winner == TEST_AI_SYMBOL) result = 1;
-    else if (game.winner == BENCHMARK_AI_SYMBOL) result = -1;
-    else result = 0; // Draw
-    
-    // Restore saved global state
-    game.winner = savedWinner;
-    
-    return result;
+
+    return 0; // Board full - draw
+}
+
+// ============================================================================
+// WORKER POOL
+// ============================================================================
+
+/**
+ * @brief Per-thread simulation state and result tallies.
+ *
+ * Each worker owns a contiguous shard of the game indices (the global
+ * index decides who starts, keeping the even start distribution) and its
+ * own explicit-state generator (rng.h), so workers never touch shared
+ * RNG state. Replaying worker seed + shard bounds reproduces that
+ * shard's games exactly.
+ */
+typedef struct {
+    int mode;            // Test AI mode for this run
+    int first_game;      // First global game index of this shard
+    int num_games;       // Number of games in this shard
+    uint64_t seed;       // Per-thread seed (recorded for reproducibility)
+    int wins, losses, draws;
+} SimWorker;
+
+static void *simulation_worker(void *arg) {
+    SimWorker *worker = (SimWorker *)arg;
+
+    Rng rng;
+    rngSeed(&rng, worker->seed);
+
+    for (int i = 0; i < worker->num_games; i++) {
+        int global_index = worker->first_game + i;
+
+        // global_index % 2 == 0 -> Test AI moves first
+        int test_ai_starts = ((global_index % 2) == 0);
+
+        int result = play_game(worker->mode, test_ai_starts, &rng);
+
+        if (result == 1) worker->wins++;
+        else if (result == -1) worker->losses++;
+        else worker->draws++;
+    }
+
+    return NULL;
 }
 
 int main() {
-    srand(time(NULL)); // Seed RNG for Imperfect AI randomness
-    
-    // Initialize minimal game state required for CheckWinner/IsBoardFull
-    game.mode = MODE_TWO_PLAYER; // Use 2P mode so stats update for X and O generically
-    
+    // One base seed, printed below; worker t derives its stream from
+    // base + t, so recording the base makes the whole run replayable
+    uint64_t base_seed = (uint64_t)time(NULL);
+
+    // Build the perfect-play tablebase once (read-only afterwards, so it
+    // is safe to share across all worker threads).
+    initMinimaxTablebase();
+
+    int num_threads = detect_core_count();
+
     // Ensure even number of games for equal starts
     int total_games = NUM_GAMES;
     if (total_games % 2 != 0) {
@@ -127,27 +204,41 @@ int main() {
     printf("Opponent: Minimax (Imperfect AI, 20%% error rate)\n");
     printf("Total Games: %d (%d starts each)\n", total_games, total_games/2);
     printf("Test AI: 'X' | Benchmark AI: 'O'\n");
+    printf("Worker Threads: %d\n", num_threads);
+    printf("Base Seed: %llu (re-run with this to reproduce)\n",
+           (unsigned long long)base_seed);
     printf("================================================================\n\n");
-    
+
     const char* mode_names[] = {"", "Perfect (Hard)", "Imperfect (Medium)", "Model (Easy)"};
-    
+
     for (int mode = 1; mode <= 3; mode++) {
-        int wins = 0;
-        int losses = 0;
-        int draws = 0;
-        
-        for (int i = 0; i < total_games; i++) {
-            // i % 2 == 0 -> test_ai_starts = 1 (Test AI moves first)
-            // i % 2 == 1 -> test_ai_starts = 0 (Benchmark AI moves first)
-            int test_ai_starts = ((i % 2) == 0);
-            
-            int result = play_game(mode, test_ai_starts);
-            
-            if (result == 1) wins++;
-            else if (result == -1) losses++;
-            else draws++;
+        SimWorker workers[MAX_THREADS] = {0};
+        pthread_t threads[MAX_THREADS];
+
+        // Shard games across the pool; the first shards absorb the remainder
+        int games_per_thread = total_games / num_threads;
+        int remainder = total_games % num_threads;
+        int next_game = 0;
+
+        for (int t = 0; t < num_threads; t++) {
+            workers[t].mode = mode;
+            workers[t].first_game = next_game;
+            workers[t].num_games = games_per_thread + (t < remainder ? 1 : 0);
+            // splitmix64 expansion in rngSeed decorrelates adjacent seeds
+            workers[t].seed = base_seed + (uint64_t)(mode * MAX_THREADS + t);
+            next_game += workers[t].num_games;
+
+            pthread_create(&threads[t], NULL, simulation_worker, &workers[t]);
+        }
+
+        int wins = 0, losses = 0, draws = 0;
+        for (int t = 0; t < num_threads; t++) {
+            pthread_join(threads[t], NULL);
+            wins += workers[t].wins;
+            losses += workers[t].losses;
+            draws += workers[t].draws;
         }
-        
+
         printf("Mode: %-20s\n", mode_names[mode]);
         printf("--------------------------------\n");
         printf("Wins:   %4d (%5.1f%%)\n", wins, (double)wins/total_games*100.0);
@@ -155,6 +246,6 @@ int main() {
         printf("Draws:  %4d (%5.1f%%)\n", draws, (double)draws/total_games*100.0);
         printf("\n");
     }
-    
+
     return 0;
 }
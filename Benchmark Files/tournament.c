@@ -0,0 +1,388 @@
+/**
+ * @file tournament.c
+ * @brief Parameter-sweep tournament engine for AI matchup studies
+ *
+ * simulation.c answers one fixed question (three test modes vs. one
+ * benchmark opponent); this runs the full cross product instead. The
+ * player list is declared once in main() - the minimax engine at every
+ * swept errorRate plus the logistic model - and every ordered pairing
+ * plays GAMES_PER_CELL games with alternating starting orders. Results
+ * aggregate into a CSV report with Wilson 95% confidence intervals, so
+ * a cell's win rate can be read with its sampling error attached.
+ *
+ * SCHEDULING: cells are split into fixed-size chunks of games and the
+ * worker pool pulls chunks from a shared queue behind a mutex (dynamic
+ * work pickup rather than per-thread deques - with uniform tiny jobs
+ * there is nothing to steal that a shared counter does not already
+ * balance). Slow cells (high errorRate means longer games) therefore
+ * never leave idle cores the way simulation.c's static shards could.
+ *
+ * COMPILATION:
+ * gcc -o "Benchmark Files\tournament.exe" "Benchmark Files\tournament.c" "Game_algorithms\Minimax.c" "Game_algorithms\model_minimax.c" "Game_algorithms\minimax_utils.c" "Game_algorithms\rng.c" "Game_algorithms\tablebase.c" -I"Game_algorithms" -pthread -static -lm
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <pthread.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+#include "../Game_algorithms/minimax.h"
+#include "../Game_algorithms/minimax_utils.h"
+#include "../Game_algorithms/model_minimax.h"
+#include "../Game_algorithms/tablebase.h"
+
+// Configuration
+#define SWEEP_STEP 10          // errorRate sweep: 0, 10, ..., 100
+#define GAMES_PER_CELL 1000    // Games per ordered pairing (must be even)
+#define CHUNK_GAMES 250        // Games per scheduler job
+#define MAX_PLAYERS 16
+#define MAX_THREADS 64
+#define WILSON_Z 1.959964      // 95% two-sided normal quantile
+#define RESULTS_FILE "tournament_results.csv"
+
+// ============================================================================
+// PLAYERS AND MATCH DRIVER
+// ============================================================================
+
+/**
+ * @brief One tournament participant.
+ *
+ * errorRate >= 0 selects the minimax engine at that error rate;
+ * errorRate < 0 selects the logistic model.
+ */
+typedef struct {
+    char name[24];
+    int errorRate;
+} Player;
+
+/**
+ * @brief Asks a player for a move on the given board.
+ */
+static struct Move player_move(const Player *player, char board[3][3],
+                               char symbol, Rng *rng) {
+    if (player->errorRate < 0) {
+        return findBestMoveModel(board, symbol);
+    }
+    return findBestMoveMinimaxRng(board, symbol, player->errorRate, rng);
+}
+
+/**
+ * @brief Plays one game between two players; A is always 'X'.
+ *
+ * Same re-entrant local-board driver as simulation.c: stack board,
+ * incremental bitboard masks, winner decided from the mover's mask, so
+ * any number of games can run concurrently.
+ *
+ * @param a_starts 1 if player A ('X') moves first
+ * @return 1 if A wins, -1 if B wins, 0 for a draw
+ */
+static int play_game(const Player *a, const Player *b, int a_starts,
+                     Rng *rng) {
+    char board[3][3];
+    memset(board, ' ', sizeof(board));
+
+    int maskX = 0, maskO = 0;
+    char current_turn = a_starts ? 'X' : 'O';
+
+    for (int plies = 0; plies < 9; plies++) {
+        const Player *mover = (current_turn == 'X') ? a : b;
+        struct Move move = player_move(mover, board, current_turn, rng);
+
+        // Fallback for invalid moves (fills first empty slot)
+        if (!(move.row >= 0 && move.row < 3 && move.col >= 0 && move.col < 3
+              && board[move.row][move.col] == ' ')) {
+            move.row = -1;
+            for (int r = 0; r < 3 && move.row < 0; r++) {
+                for (int c = 0; c < 3; c++) {
+                    if (board[r][c] == ' ') {
+                        move.row = r;
+                        move.col = c;
+                        break;
+                    }
+                }
+            }
+        }
+
+        board[move.row][move.col] = current_turn;
+        int bit = 1 << (move.row * 3 + move.col);
+        if (current_turn == 'X') maskX |= bit;
+        else maskO |= bit;
+
+        // Only the player who just moved can have completed a line
+        if (current_turn == 'X' && isWinnerMask(maskX)) return 1;
+        if (current_turn == 'O' && isWinnerMask(maskO)) return -1;
+
+        current_turn = (current_turn == 'X') ? 'O' : 'X';
+    }
+
+    return 0; // Board full - draw
+}
+
+// ============================================================================
+// SCHEDULER
+// ============================================================================
+
+/**
+ * @brief One scheduler job: a chunk of games inside one matchup cell.
+ *
+ * The global game index inside the cell decides the starting order, so
+ * every cell keeps an exactly even start distribution no matter how its
+ * chunks are interleaved across workers.
+ */
+typedef struct {
+    int cell;        // Index into the cells array
+    int first_game;  // First in-cell game index of this chunk
+    int num_games;
+} MatchJob;
+
+/**
+ * @brief Aggregated tallies for one ordered pairing (A as X, B as O).
+ */
+typedef struct {
+    int playerA, playerB; // Indices into the players array
+    int winsA, winsB, draws;
+} MatchCell;
+
+typedef struct {
+    const Player *players;
+    MatchCell *cells;
+    MatchJob *jobs;
+    int num_jobs;
+    int next_job;          // Shared cursor, guarded by lock
+    pthread_mutex_t lock;  // Also guards the cell tallies on job completion
+    int jobs_done;         // For the progress line
+} Tournament;
+
+/** Per-thread view: the shared tournament plus this worker's generator. */
+typedef struct {
+    Tournament *tournament;
+    uint64_t seed; // Recorded so any worker's stream can be replayed
+} TournamentWorker;
+
+static void *tournament_worker(void *arg) {
+    TournamentWorker *worker = (TournamentWorker *)arg;
+    Tournament *t = worker->tournament;
+
+    Rng rng;
+    rngSeed(&rng, worker->seed);
+
+    for (;;) {
+        // Pull the next unclaimed job; chunks are uniform, so a shared
+        // cursor keeps every core busy until the queue is empty
+        pthread_mutex_lock(&t->lock);
+        int job_index = t->next_job;
+        if (job_index < t->num_jobs) {
+            t->next_job++;
+        }
+        pthread_mutex_unlock(&t->lock);
+        if (job_index >= t->num_jobs) {
+            return NULL;
+        }
+
+        MatchJob *job = &t->jobs[job_index];
+        MatchCell *cell = &t->cells[job->cell];
+        const Player *a = &t->players[cell->playerA];
+        const Player *b = &t->players[cell->playerB];
+
+        int winsA = 0, winsB = 0, draws = 0;
+        for (int i = 0; i < job->num_games; i++) {
+            int a_starts = (((job->first_game + i) % 2) == 0);
+            int result = play_game(a, b, a_starts, &rng);
+            if (result == 1) winsA++;
+            else if (result == -1) winsB++;
+            else draws++;
+        }
+
+        // Merge this chunk's tallies under the same lock as the cursor
+        pthread_mutex_lock(&t->lock);
+        cell->winsA += winsA;
+        cell->winsB += winsB;
+        cell->draws += draws;
+        t->jobs_done++;
+        if (t->jobs_done % 64 == 0 || t->jobs_done == t->num_jobs) {
+            printf("\r  %d / %d jobs", t->jobs_done, t->num_jobs);
+            fflush(stdout);
+        }
+        pthread_mutex_unlock(&t->lock);
+    }
+}
+
+// ============================================================================
+// REPORTING
+// ============================================================================
+
+/**
+ * @brief Wilson score interval for a binomial proportion.
+ *
+ * Unlike the normal approximation, this stays inside [0, 1] and behaves
+ * at the extreme rates the sweep produces (perfect play wins 0% or
+ * draws 100% of some cells).
+ */
+static void wilson_interval(int successes, int trials,
+                            double *low, double *high) {
+    if (trials == 0) {
+        *low = 0.0;
+        *high = 1.0;
+        return;
+    }
+    double n = (double)trials;
+    double p = (double)successes / n;
+    double z2 = WILSON_Z * WILSON_Z;
+    double denom = 1.0 + z2 / n;
+    double center = (p + z2 / (2.0 * n)) / denom;
+    double half = WILSON_Z *
+        sqrt(p * (1.0 - p) / n + z2 / (4.0 * n * n)) / denom;
+    *low = center - half;
+    *high = center + half;
+}
+
+static int detect_core_count(void) {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    int cores = (int)info.dwNumberOfProcessors;
+#else
+    int cores = (int)sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+    if (cores < 1) cores = 1;
+    if (cores > MAX_THREADS) cores = MAX_THREADS;
+    return cores;
+}
+
+int main() {
+    // One base seed for the run; worker t draws from base + t
+    uint64_t base_seed = (uint64_t)time(NULL);
+    initMinimaxTablebase();
+
+    // Pick up retrained model parameters when present
+    if (!loadModelParams("logistic_regression_params.json")) {
+        loadModelParams("../Game_algorithms/logistic_regression_params.json");
+    }
+
+    // ------------------------------------------------------------------
+    // Matchup matrix declaration: the full errorRate sweep plus the
+    // logistic model, every ordered pairing. Edit this block (or
+    // SWEEP_STEP / GAMES_PER_CELL above) to shape a study.
+    // ------------------------------------------------------------------
+    Player players[MAX_PLAYERS];
+    int num_players = 0;
+    for (int rate = 0; rate <= 100; rate += SWEEP_STEP) {
+        snprintf(players[num_players].name, sizeof(players[num_players].name),
+                 "minimax_e%d", rate);
+        players[num_players].errorRate = rate;
+        num_players++;
+    }
+    snprintf(players[num_players].name, sizeof(players[num_players].name),
+             "model");
+    players[num_players].errorRate = -1;
+    num_players++;
+
+    int num_cells = num_players * num_players;
+    int chunks_per_cell = (GAMES_PER_CELL + CHUNK_GAMES - 1) / CHUNK_GAMES;
+    int num_jobs = num_cells * chunks_per_cell;
+    int num_threads = detect_core_count();
+
+    printf("================================================================\n");
+    printf("AI TOURNAMENT: PARAMETER SWEEP\n");
+    printf("----------------------------------------------------------------\n");
+    printf("Players: %d (errorRate 0-100 step %d, plus model)\n",
+           num_players, SWEEP_STEP);
+    printf("Cells: %d ordered pairings x %d games = %d games\n",
+           num_cells, GAMES_PER_CELL, num_cells * GAMES_PER_CELL);
+    printf("Jobs: %d chunks of %d games | Worker Threads: %d\n",
+           num_jobs, CHUNK_GAMES, num_threads);
+    printf("Base Seed: %llu\n", (unsigned long long)base_seed);
+    printf("================================================================\n\n");
+
+    MatchCell *cells = calloc((size_t)num_cells, sizeof(MatchCell));
+    MatchJob *jobs = calloc((size_t)num_jobs, sizeof(MatchJob));
+    if (cells == NULL || jobs == NULL) {
+        fprintf(stderr, "ERROR: Out of memory for tournament tables\n");
+        return 1;
+    }
+
+    int job = 0;
+    for (int a = 0; a < num_players; a++) {
+        for (int b = 0; b < num_players; b++) {
+            int cell = a * num_players + b;
+            cells[cell].playerA = a;
+            cells[cell].playerB = b;
+
+            for (int first = 0; first < GAMES_PER_CELL; first += CHUNK_GAMES) {
+                jobs[job].cell = cell;
+                jobs[job].first_game = first;
+                jobs[job].num_games =
+                    (first + CHUNK_GAMES <= GAMES_PER_CELL)
+                        ? CHUNK_GAMES : GAMES_PER_CELL - first;
+                job++;
+            }
+        }
+    }
+
+    Tournament tournament = {
+        .players = players,
+        .cells = cells,
+        .jobs = jobs,
+        .num_jobs = num_jobs,
+        .next_job = 0,
+        .jobs_done = 0,
+    };
+    pthread_mutex_init(&tournament.lock, NULL);
+
+    clock_t start = clock();
+    pthread_t threads[MAX_THREADS];
+    TournamentWorker workers[MAX_THREADS];
+    for (int tn = 0; tn < num_threads; tn++) {
+        workers[tn].tournament = &tournament;
+        workers[tn].seed = base_seed + (uint64_t)tn;
+        pthread_create(&threads[tn], NULL, tournament_worker, &workers[tn]);
+    }
+    for (int tn = 0; tn < num_threads; tn++) {
+        pthread_join(threads[tn], NULL);
+    }
+    double elapsed = (double)(clock() - start) / CLOCKS_PER_SEC;
+    printf("\n\nAll games complete (%.1f CPU-seconds across %d threads)\n\n",
+           elapsed, num_threads);
+    pthread_mutex_destroy(&tournament.lock);
+
+    // ------------------------------------------------------------------
+    // CSV report: one row per ordered pairing, win/draw/loss counts and
+    // Wilson 95% intervals on player A's win and non-loss rates
+    // ------------------------------------------------------------------
+    FILE *csv = fopen(RESULTS_FILE, "w");
+    if (csv == NULL) {
+        fprintf(stderr, "ERROR: Could not open %s for writing\n", RESULTS_FILE);
+        free(cells);
+        free(jobs);
+        return 1;
+    }
+    fprintf(csv, "player_a,player_b,games,wins_a,draws,wins_b,"
+                 "win_rate_a,win_ci_low,win_ci_high,"
+                 "nonloss_rate_a,nonloss_ci_low,nonloss_ci_high\n");
+
+    for (int cell = 0; cell < num_cells; cell++) {
+        const MatchCell *c = &cells[cell];
+        int games = c->winsA + c->winsB + c->draws;
+        double winLow, winHigh, nlLow, nlHigh;
+        wilson_interval(c->winsA, games, &winLow, &winHigh);
+        wilson_interval(c->winsA + c->draws, games, &nlLow, &nlHigh);
+
+        fprintf(csv, "%s,%s,%d,%d,%d,%d,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f\n",
+                players[c->playerA].name, players[c->playerB].name,
+                games, c->winsA, c->draws, c->winsB,
+                (double)c->winsA / games, winLow, winHigh,
+                (double)(c->winsA + c->draws) / games, nlLow, nlHigh);
+    }
+    fclose(csv);
+    printf("Report written to %s (%d rows)\n", RESULTS_FILE, num_cells);
+
+    free(cells);
+    free(jobs);
+    return 0;
+}
@@ -0,0 +1,297 @@
+/**
+ * @file train_model.c
+ * @brief Native self-play training pipeline for the logistic regression model
+ *
+ * Replaces the Jupyter notebook workflow (AI_development.ipynb): data
+ * generation, training, and parameter export all happen in one C program,
+ * so retraining is one command instead of a Python environment. The
+ * pipeline is:
+ *
+ *   1. Self-play: findBestMoveMinimax acts as the oracle for both sides
+ *      (with an error rate for position diversity - perfect play would
+ *      only ever produce one drawn game). Each completed game contributes
+ *      its final board, labeled 1 if X won and 0 otherwise, matching the
+ *      notebook's "probability that X wins on completed board states".
+ *   2. Training: full-batch gradient descent on the logistic loss. The
+ *      forward pass reuses evaluateBoardsLogisticBatch over one flat
+ *      feature array, so each epoch is a single vectorizable sweep.
+ *   3. Export: parameters are written to logistic_regression_params.json
+ *      in the same format the notebook emitted; loadModelParams picks
+ *      them up at the next game/engine startup - no rebuild needed.
+ *
+ * COMPILATION:
+ * gcc -o "Benchmark Files\train_model.exe" "Benchmark Files\train_model.c" "Game_algorithms\Minimax.c" "Game_algorithms\model_minimax.c" "Game_algorithms\minimax_utils.c" "Game_algorithms\rng.c" "Game_algorithms\tablebase.c" -I"Game_algorithms" -static -lm
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "../Game_algorithms/minimax.h"
+#include "../Game_algorithms/minimax_utils.h"
+#include "../Game_algorithms/model_minimax.h"
+#include "../Game_algorithms/tablebase.h"
+
+// Configuration
+#define TRAIN_GAMES 5000       // Self-play games (one sample per game)
+#define ORACLE_ERROR_RATE 25   // Oracle randomness, for position diversity
+#define LEARNING_RATE 0.1
+#define EPOCHS 2000
+#define REPORT_EVERY 500       // Epochs between progress lines
+#define PARAMS_FILE "../Game_algorithms/logistic_regression_params.json"
+
+// The live model parameters from model_minimax.c - training writes them
+// in place so evaluateBoardsLogisticBatch serves as the forward pass.
+extern double LR_WEIGHTS[9];
+extern double LR_BIAS;
+
+// ============================================================================
+// SELF-PLAY DATA GENERATION
+// ============================================================================
+
+/**
+ * @brief Plays one oracle self-play game and records its final board.
+ *
+ * Same re-entrant local-board driver as simulation.c: moves land on a
+ * stack board with incremental bitboard masks, and the winner is decided
+ * from the mover's mask. Both sides are the minimax oracle with
+ * ORACLE_ERROR_RATE so the games reach varied completed states.
+ *
+ * @param x_starts 1 if X moves first, 0 if O moves first
+ * @param features Output: 9 packed features of the final board
+ * @param rng Generator for the oracle's rolls and tie-breaks
+ * @return 1 if X won, 0 otherwise (O win or draw)
+ */
+static int play_training_game(int x_starts, signed char features[9],
+                              Rng *rng) {
+    char board[3][3];
+    memset(board, ' ', sizeof(board));
+
+    int maskX = 0, maskO = 0;
+    char current_turn = x_starts ? 'X' : 'O';
+    int x_won = 0;
+
+    for (int plies = 0; plies < 9; plies++) {
+        struct Move move = findBestMoveMinimaxRng(board, current_turn,
+                                                  ORACLE_ERROR_RATE, rng);
+
+        // Fallback for invalid moves (fills first empty slot)
+        if (!(move.row >= 0 && move.row < 3 && move.col >= 0 && move.col < 3
+              && board[move.row][move.col] == ' ')) {
+            move.row = -1;
+            for (int r = 0; r < 3 && move.row < 0; r++) {
+                for (int c = 0; c < 3; c++) {
+                    if (board[r][c] == ' ') {
+                        move.row = r;
+                        move.col = c;
+                        break;
+                    }
+                }
+            }
+        }
+
+        board[move.row][move.col] = current_turn;
+        int bit = 1 << (move.row * 3 + move.col);
+        if (current_turn == 'X') maskX |= bit;
+        else maskO |= bit;
+
+        // Only the player who just moved can have completed a line
+        if (current_turn == 'X' && isWinnerMask(maskX)) {
+            x_won = 1;
+            break;
+        }
+        if (current_turn == 'O' && isWinnerMask(maskO)) {
+            break;
+        }
+
+        current_turn = (current_turn == 'X') ? 'O' : 'X';
+    }
+
+    boardToFeatures(board, features);
+    return x_won;
+}
+
+// ============================================================================
+// TRAINING
+// ============================================================================
+
+static double sigmoid(double z) {
+    return 1.0 / (1.0 + exp(-z));
+}
+
+/**
+ * @brief Full-batch gradient descent on the logistic loss.
+ *
+ * Each epoch: one evaluateBoardsLogisticBatch sweep for all logits (the
+ * fixed-width inner product it exposes is the whole forward pass), then
+ * one accumulation sweep for the gradient. Parameters update in place in
+ * LR_WEIGHTS/LR_BIAS, so the batch evaluator always scores with the
+ * current epoch's weights.
+ *
+ * @param features count * 9 packed features, position-major
+ * @param labels count labels (1 = X won, 0 = otherwise)
+ * @param count Number of training samples
+ */
+static void train(const signed char *features, const unsigned char *labels,
+                  int count) {
+    double *logits = malloc((size_t)count * sizeof(double));
+    if (logits == NULL) {
+        fprintf(stderr, "ERROR: Out of memory for logits buffer\n");
+        exit(1);
+    }
+
+    // Start from zero so the result reflects only this run's data
+    memset(LR_WEIGHTS, 0, sizeof(LR_WEIGHTS));
+    LR_BIAS = 0.0;
+
+    for (int epoch = 1; epoch <= EPOCHS; epoch++) {
+        // Forward pass: logits for every sample in one vectorized sweep
+        evaluateBoardsLogisticBatch(features, count, logits);
+
+        // Gradient of the mean logistic loss: sum (p - y) * x over samples
+        double grad_w[9] = {0};
+        double grad_b = 0.0;
+        double loss = 0.0;
+        int correct = 0;
+
+        for (int i = 0; i < count; i++) {
+            double p = sigmoid(logits[i]);
+            double y = (double)labels[i];
+            double err = p - y;
+
+            const signed char *f = features + i * 9;
+            for (int j = 0; j < 9; j++) {
+                grad_w[j] += err * f[j];
+            }
+            grad_b += err;
+
+            // Clamp avoids log(0) from saturated predictions
+            double p_true = labels[i] ? p : 1.0 - p;
+            if (p_true < 1e-12) p_true = 1e-12;
+            loss -= log(p_true);
+            correct += (p >= 0.5) == (labels[i] != 0);
+        }
+
+        for (int j = 0; j < 9; j++) {
+            LR_WEIGHTS[j] -= LEARNING_RATE * grad_w[j] / count;
+        }
+        LR_BIAS -= LEARNING_RATE * grad_b / count;
+
+        if (epoch % REPORT_EVERY == 0 || epoch == EPOCHS) {
+            printf("Epoch %5d | loss %.4f | accuracy %5.1f%%\n",
+                   epoch, loss / count, (double)correct / count * 100.0);
+        }
+    }
+
+    free(logits);
+}
+
+// ============================================================================
+// PARAMETER EXPORT
+// ============================================================================
+
+/**
+ * @brief Writes the trained parameters in the notebook's JSON format.
+ *
+ * Key layout matches the file AI_development.ipynb used to emit, so
+ * loadModelParams (and any external tooling) reads old and new files
+ * identically.
+ */
+static int write_params(const char *path) {
+    FILE *file = fopen(path, "w");
+    if (file == NULL) {
+        return 0;
+    }
+
+    fprintf(file, "{\n");
+    fprintf(file, "  \"model_type\": \"logistic_regression\",\n");
+    fprintf(file, "  \"weights\": [\n");
+    for (int j = 0; j < 9; j++) {
+        fprintf(file, "    %.17g%s\n", LR_WEIGHTS[j], (j < 8) ? "," : "");
+    }
+    fprintf(file, "  ],\n");
+    fprintf(file, "  \"bias\": %.17g,\n", LR_BIAS);
+    fprintf(file, "  \"classes\": [0, 1],\n");
+    fprintf(file, "  \"n_features\": 9,\n");
+    fprintf(file, "  \"encoding\": \"X=1, O=-1, Empty=0\",\n");
+    fprintf(file, "  \"note\": \"Model predicts probability that X wins on completed board states\"\n");
+    fprintf(file, "}\n");
+
+    fclose(file);
+    return 1;
+}
+
+int main() {
+    // Recordable seed: re-running with the same value regenerates the
+    // identical data set and therefore the identical model
+    uint64_t seed = (uint64_t)time(NULL);
+    Rng rng;
+    rngSeed(&rng, seed);
+
+    // The oracle serves every move from the tablebase after this
+    initMinimaxTablebase();
+
+    printf("================================================================\n");
+    printf("SELF-PLAY TRAINING PIPELINE\n");
+    printf("----------------------------------------------------------------\n");
+    printf("Oracle: Minimax (%d%% error rate, both sides)\n", ORACLE_ERROR_RATE);
+    printf("Games: %d | Epochs: %d | Learning rate: %g\n",
+           TRAIN_GAMES, EPOCHS, LEARNING_RATE);
+    printf("Seed: %llu\n", (unsigned long long)seed);
+    printf("================================================================\n\n");
+
+    // One flat position-major feature block, ready for the batch evaluator
+    signed char *features = malloc((size_t)TRAIN_GAMES * 9);
+    unsigned char *labels = malloc((size_t)TRAIN_GAMES);
+    if (features == NULL || labels == NULL) {
+        fprintf(stderr, "ERROR: Out of memory for training data\n");
+        return 1;
+    }
+
+    printf("Generating %d self-play games...\n", TRAIN_GAMES);
+    int x_wins = 0;
+    for (int i = 0; i < TRAIN_GAMES; i++) {
+        // Alternate who starts for a balanced label distribution
+        labels[i] = (unsigned char)play_training_game(i % 2 == 0,
+                                                      features + i * 9, &rng);
+        x_wins += labels[i];
+    }
+    printf("Done: %d X wins (%.1f%%), %d other outcomes\n\n",
+           x_wins, (double)x_wins / TRAIN_GAMES * 100.0,
+           TRAIN_GAMES - x_wins);
+
+    printf("Training (%d epochs, full batch)...\n", EPOCHS);
+    train(features, labels, TRAIN_GAMES);
+    printf("\n");
+
+    printf("Trained parameters:\n");
+    for (int j = 0; j < 9; j++) {
+        printf("  w[%d] = %+.6f\n", j, LR_WEIGHTS[j]);
+    }
+    printf("  bias = %+.6f\n\n", LR_BIAS);
+
+    // Update the source-tree copy (run from bin\, like the benchmarks)
+    // and the working-directory copy the game loads first, so both stay
+    // in sync. Running from the repo root only hits the second path.
+    int written = 0;
+    if (write_params(PARAMS_FILE)) {
+        printf("Parameters written to %s\n", PARAMS_FILE);
+        written++;
+    }
+    if (write_params("logistic_regression_params.json")) {
+        printf("Parameters written to logistic_regression_params.json\n");
+        written++;
+    }
+    if (written == 0) {
+        fprintf(stderr, "ERROR: Could not write params file\n");
+        free(features);
+        free(labels);
+        return 1;
+    }
+    printf("They are picked up automatically at the next startup.\n");
+
+    free(features);
+    free(labels);
+    return 0;
+}
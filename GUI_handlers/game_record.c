@@ -0,0 +1,153 @@
+/**
+ * @file game_record.c
+ * @brief Implementation of the binary packed game-record format
+ */
+
+#include "game_record.h"
+#include "game_state.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// ============================================================================
+// MOVE PACKING
+// ============================================================================
+
+unsigned long long packMoves(const unsigned char *moves, int count)
+{
+    unsigned long long packed = 0;
+    for (int i = 0; i < count && i < 9; i++) {
+        packed |= ((unsigned long long)(moves[i] & 0xF)) << (4 * i);
+    }
+    return packed;
+}
+
+int unpackMove(unsigned long long packed, int index)
+{
+    return (int)((packed >> (4 * index)) & 0xF);
+}
+
+// ============================================================================
+// RECORD FILE I/O
+// ============================================================================
+
+bool AppendGameRecord(void)
+{
+    // A resumed game has no reliable move sequence - recording it would
+    // produce an unreplayable record, so it is skipped.
+    if (!game.movesKnown) {
+        return false;
+    }
+
+    GameRecord record = {0};
+    record.version = GAME_RECORD_VERSION;
+    record.moveCount = (unsigned char)game.movesPlayedCount;
+    record.firstPlayer = (game.firstMover == 'O') ? 1 : 0;
+    record.mode = (unsigned char)game.mode;
+    record.difficulty = (unsigned char)game.difficulty;
+    record.winner = game.winner;
+    record.packedMoves = packMoves(game.movesPlayed, game.movesPlayedCount);
+
+    FILE* file = fopen(GAME_RECORD_FILE, "ab");
+    if (file == NULL) {
+        return false;
+    }
+
+    size_t written = fwrite(&record, sizeof(GameRecord), 1, file);
+    fclose(file);
+    return written == 1;
+}
+
+int CountGameRecords(void)
+{
+    FILE* file = fopen(GAME_RECORD_FILE, "rb");
+    if (file == NULL) {
+        return 0;
+    }
+
+    // Fixed-size records: the count is just the file size divided down
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fclose(file);
+
+    if (size < 0) {
+        return 0;
+    }
+    return (int)(size / (long)sizeof(GameRecord));
+}
+
+bool ReadGameRecord(int index, GameRecord *record)
+{
+    if (index < 0 || record == NULL) {
+        return false;
+    }
+
+    FILE* file = fopen(GAME_RECORD_FILE, "rb");
+    if (file == NULL) {
+        return false;
+    }
+
+    // Fixed-size records make this a single seek, no scanning
+    if (fseek(file, (long)index * (long)sizeof(GameRecord), SEEK_SET) != 0) {
+        fclose(file);
+        return false;
+    }
+
+    size_t itemsRead = fread(record, sizeof(GameRecord), 1, file);
+    fclose(file);
+
+    if (itemsRead != 1 || record->version != GAME_RECORD_VERSION ||
+        record->moveCount > 9) {
+        return false;
+    }
+    return true;
+}
+
+// ============================================================================
+// REPLAY
+// ============================================================================
+
+bool LoadGameReplay(int index)
+{
+    GameRecord record;
+    if (!ReadGameRecord(index, &record)) {
+        return false;
+    }
+
+    // The per-game delta arena from ResetBoard is sized for every path
+    // (up to 9 replay deltas), so this only fails if that allocation
+    // failed.
+    if (game.moveHistory == NULL || game.moveCapacity < record.moveCount) {
+        return false;
+    }
+
+    // Unpack one delta per ply; the replay screen folds the first
+    // replayStep deltas onto an empty board to show the position after
+    // that many moves. The scratch board here only validates legality.
+    char board[3][3];
+    memset(board, ' ', sizeof(board));
+    char turn = (record.firstPlayer == 1) ? 'O' : 'X';
+
+    for (int ply = 0; ply < record.moveCount; ply++) {
+        int pos = unpackMove(record.packedMoves, ply);
+        if (pos > 8 || board[pos / 3][pos % 3] != ' ') {
+            return false; // Corrupt record: illegal move
+        }
+        board[pos / 3][pos % 3] = turn;
+
+        game.moveHistory[ply].cell = (unsigned char)pos;
+        game.moveHistory[ply].symbol = turn;
+        game.moveHistory[ply].prevPlayer = turn;
+        game.moveHistory[ply].prevAiTurn = false;
+        game.moveHistory[ply].byAI = false;
+
+        turn = (turn == 'X') ? 'O' : 'X';
+    }
+
+    // Reset the replay cursor to the start of the game
+    game.replayGameIndex = index;
+    game.replayStep = 0;
+    game.replayTotalPlies = record.moveCount;
+    game.replayWinner = record.winner;
+    return true;
+}
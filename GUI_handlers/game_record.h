@@ -0,0 +1,94 @@
+/**
+ * @file game_record.h
+ * @brief Binary packed game records with replay support
+ *
+ * Every finished game can be stored as one fixed 16-byte record in
+ * "game_records.dat": a small header (version, ply count, who moved
+ * first, mode/difficulty, winner) plus the full move sequence bit-packed
+ * at 4 bits per move (9 moves fit in the low 36 bits of a uint64). A
+ * million games cost ~16 MB and parse at memory bandwidth, unlike the
+ * text lines in game_history.txt which only store the outcome.
+ *
+ * Records are indexable by file position, so any game can be fetched
+ * with one fseek and replayed by rebuilding MoveSnapshot states.
+ */
+
+#ifndef GAME_RECORD_H
+#define GAME_RECORD_H
+
+#include <stdbool.h>
+
+#define GAME_RECORD_FILE "game_records.dat"
+#define GAME_RECORD_VERSION 1
+
+/**
+ * @struct GameRecord
+ * @brief One finished game, fixed size on disk.
+ */
+typedef struct {
+    unsigned char version;     /**< GAME_RECORD_VERSION */
+    unsigned char moveCount;   /**< Number of plies played (0-9) */
+    unsigned char firstPlayer; /**< 0 = X moved first, 1 = O moved first */
+    unsigned char mode;        /**< GameMode at the time of play */
+    unsigned char difficulty;  /**< AI difficulty (1P games) */
+    char winner;               /**< 'X', 'O', or ' ' for a draw */
+    unsigned char reserved[2]; /**< Padding / future use, written as zero */
+    unsigned long long packedMoves; /**< Move i = cell index in bits 4i..4i+3 */
+} GameRecord;
+
+/**
+ * @brief Packs a move sequence into the 4-bits-per-move layout.
+ *
+ * @param moves Cell indices (0-8) in play order
+ * @param count Number of moves (0-9)
+ * @return Packed move word (move i occupies bits 4i..4i+3)
+ */
+unsigned long long packMoves(const unsigned char *moves, int count);
+
+/**
+ * @brief Extracts one move from a packed move word.
+ *
+ * @param packed Packed move word from a GameRecord
+ * @param index Ply number (0-8)
+ * @return Cell index (0-8) of that move
+ */
+int unpackMove(unsigned long long packed, int index);
+
+/**
+ * @brief Appends the just-finished game as a binary record.
+ *
+ * Reads the move sequence tracked in the global game state. Games whose
+ * full sequence is unknown (resumed from a save) are skipped, since a
+ * partial sequence would make the record unreplayable.
+ *
+ * @return true if a record was written
+ */
+bool AppendGameRecord(void);
+
+/**
+ * @brief Returns the number of records in "game_records.dat".
+ */
+int CountGameRecords(void);
+
+/**
+ * @brief Reads one record by index (single fseek, no scan).
+ *
+ * @param index Record number (0 .. CountGameRecords() - 1)
+ * @param record Output record
+ * @return true if the record was read and its version is supported
+ */
+bool ReadGameRecord(int index, GameRecord *record);
+
+/**
+ * @brief Loads a recorded game into the replay viewer state.
+ *
+ * Rebuilds the position after every ply as MoveSnapshot entries in
+ * game.moveHistory (reusing the undo machinery) and resets the replay
+ * cursor, so the viewer can step through snapshots directly.
+ *
+ * @param index Record number to replay
+ * @return true if the record was loaded
+ */
+bool LoadGameReplay(int index);
+
+#endif // GAME_RECORD_H
@@ -6,9 +6,22 @@
  */
 
 #include "game_state.h"
+#include "game_record.h" // For binary game records
+#include "resource_cache.h" // For async sound loading / cached handles
 #include "../Game_algorithms/minimax.h" // For AI move functions
+#include "../Game_algorithms/minimax_utils.h" // For bitboard mask helpers
+#include "../Game_algorithms/tablebase.h" // For perfect-play tablebase init
+#include "../Game_algorithms/model_minimax.h" // For logistic model parameter loading
 #include <stdio.h> // For file I/O (fopen, fwrite, fread, fclose)
 #include <string.h> // For sprintf
+#include <pthread.h> // For the asynchronous AI search worker
+#include <time.h> // For the journal writer's flush-window deadline
+#include <errno.h> // For ETIMEDOUT from pthread_cond_timedwait
+#ifdef _WIN32
+#include <io.h> // For _commit (flush file buffers to disk)
+#else
+#include <unistd.h> // For fsync
+#endif
 
 /**
  * @brief Static definition of all available themes.
@@ -93,6 +106,72 @@ Color colorLight = {0};
  */
 GameState game = {0};
 
+// ============================================================================
+// ARENA ALLOCATOR
+// ============================================================================
+
+/**
+ * @brief Grows the arena's backing block to at least `capacity` bytes.
+ * * Only legal while the arena is empty - growing would move the block
+ * and dangle every pointer already handed out. Both arenas are sized at
+ * their reset points (new game, new page), so allocations never need to
+ * grow mid-use.
+ */
+static bool arenaEnsure(Arena *arena, size_t capacity)
+{
+    if (arena->capacity >= capacity) {
+        return true;
+    }
+    if (arena->used != 0) {
+        return false;
+    }
+
+    char *newBlock = (char *)realloc(arena->block, capacity);
+    if (newBlock == NULL) {
+        return false;
+    }
+    arena->block = newBlock;
+    arena->capacity = capacity;
+    return true;
+}
+
+/**
+ * @brief Bump-allocates `size` bytes out of the arena.
+ * * @return Pointer into the backing block, or NULL if the arena is full
+ */
+static void *arenaAlloc(Arena *arena, size_t size)
+{
+    // Keep every allocation 8-byte aligned for struct use
+    size_t aligned = (size + 7u) & ~(size_t)7u;
+    if (arena->used + aligned > arena->capacity) {
+        if (!arenaEnsure(arena, aligned)) {
+            return NULL;
+        }
+    }
+
+    void *ptr = arena->block + arena->used;
+    arena->used += aligned;
+    return ptr;
+}
+
+/** @brief Recycles every allocation in the arena at once. */
+static void arenaReset(Arena *arena)
+{
+    arena->used = 0;
+}
+
+/** @brief Releases the arena's backing block (program teardown only). */
+static void arenaFree(Arena *arena)
+{
+    free(arena->block);
+    arena->block = NULL;
+    arena->capacity = 0;
+    arena->used = 0;
+}
+
+// Delta slots per game: 9 plies of undo or 9 replay moves fit
+#define MOVE_ARENA_DELTAS 16
+
 // ============================================================================
 // INITIALIZATION AND CLEANUP
 // ============================================================================
@@ -136,22 +215,43 @@ void InitGame(void)
     game.moveCount = 0;
     game.moveCapacity = 0;
     
-    // OPTIMIZATION: Initialize dynamic game history
+    // OPTIMIZATION: Initialize dynamic game history (index + page buffer)
     game.gameHistory = NULL;
     game.historyLineCount = 0;
     game.historyCapacity = 0;
     game.historyScrollOffset = 0;
+    game.historyIndex = NULL;
+    game.historyIndexCapacity = 0;
+    game.historyFileSize = 0;
+    game.historyPageStart = 0;
+    game.historyPageCount = 0;
 
     // INITIALIZE SIMULATION
     game.simTimer = 0.0f;
     game.simStep = 0;
 
-    // Load sound effects
-    game.sfx.click     = LoadSound("resources/click.ogg"); // Buttons & Inputs
-    game.sfx.win = LoadSound("resources/win.ogg");  // Win 1P
-    game.sfx.lose       = LoadSound("resources/lose.ogg"); // Lose 1P
-    game.sfx.draw      = LoadSound("resources/draw.ogg"); // Draw
+    // OPTIMIZATION: Sound decoding used to run synchronously here, which
+    // held up the first menu frame on slow kiosk storage. The resource
+    // cache decodes on a background thread; the handles stay zeroed
+    // (silent no-ops) until the main loop's pump commits them.
+    memset(&game.sfx, 0, sizeof(game.sfx));
+    ResourceCacheBeginLoad();
+
+    // OPTIMIZATION: Start the write-behind journal so history appends
+    // and autosaves cost the frame loop a queue push, not a disk write
+    JournalStart();
     
+    // Load the latest trained model parameters if a params file is
+    // present (working directory first, then the source tree); the
+    // compiled-in defaults stay in effect when neither exists.
+    if (!loadModelParams("logistic_regression_params.json")) {
+        loadModelParams("Game_algorithms/logistic_regression_params.json");
+    }
+
+    // Build the perfect-play tablebase once so hard/medium AI moves are
+    // served from a lookup instead of a fresh search every call.
+    initMinimaxTablebase();
+
     ChangeTheme(THEME_DEFAULT);
     ResetBoard();
 }
@@ -161,30 +261,35 @@ void InitGame(void)
  * Must be called before program exit to prevent memory leaks.
  */
 void CleanupGame(void) {
-    // Free move history
-    if (game.moveHistory != NULL) {
-        free(game.moveHistory);
-        game.moveHistory = NULL;
-    }
+    // Drain the write-behind journal first: everything still queued
+    // (last history line, final autosave) reaches disk before exit
+    JournalShutdown();
+
+    // Move deltas live in the per-game arena, not their own block
+    arenaFree(&game.moveArena);
+    game.moveHistory = NULL;
     game.moveCount = 0;
     game.moveCapacity = 0;
     
-    // Free game history
+    // Free game history page buffer, its text arena, and the line index
     if (game.gameHistory != NULL) {
-        for (int i = 0; i < game.historyLineCount; i++) {
-            free(game.gameHistory[i]);
-        }
         free(game.gameHistory);
         game.gameHistory = NULL;
     }
+    arenaFree(&game.historyArena);
+    if (game.historyIndex != NULL) {
+        free(game.historyIndex);
+        game.historyIndex = NULL;
+    }
     game.historyLineCount = 0;
     game.historyCapacity = 0;
+    game.historyIndexCapacity = 0;
+    game.historyFileSize = 0;
+    game.historyPageStart = 0;
+    game.historyPageCount = 0;
 
-    // Unload sound effects
-    UnloadSound(game.sfx.click);
-    UnloadSound(game.sfx.win);
-    UnloadSound(game.sfx.lose);
-    UnloadSound(game.sfx.draw);
+    // The cache owns the sound handles; game.sfx only borrows them
+    ResourceCacheShutdown();
 }
 
 // ============================================================================
@@ -203,7 +308,16 @@ void ResetBoard(void)
             game.board[i][j] = ' ';
         }
     }
-    
+
+    // Clear the bitboard masks (kept in sync with the board)
+    game.maskX = 0;
+    game.maskO = 0;
+
+    // Fresh game: the full move sequence will be known from here on
+    game.movesPlayedCount = 0;
+    game.firstMover = ' ';
+    game.movesKnown = true;
+
     // Reset game state
     game.currentPlayer = game.humanSymbol; // Human (or P1) always starts
     game.gameOver = false;
@@ -214,6 +328,52 @@ void ResetBoard(void)
     game.aiMoveTimer = 0.5f;  // Delay before AI makes its first move
     game.saveMessageTimer = 0.0f; // Hide any save messages
     game.moveCount = 0;           // Reset move history for new game
+
+    // Recycle the per-game arena and carve out this game's delta stack -
+    // one bump allocation instead of realloc growth.
+    arenaReset(&game.moveArena);
+    game.moveHistory = (MoveDelta *)arenaAlloc(
+        &game.moveArena, MOVE_ARENA_DELTAS * sizeof(MoveDelta));
+    game.moveCapacity = (game.moveHistory != NULL) ? MOVE_ARENA_DELTAS : 0;
+
+    // A search submitted for the previous position is now meaningless
+    CancelAIMoveSearch();
+}
+
+/**
+ * @brief Places a symbol on the board, keeping the bitboard masks in sync.
+ * * Single mutation point for moves: writing the cell and setting the
+ * matching mask bit here is what makes the incremental win checks below
+ * safe to use everywhere else.
+ */
+void PlaceSymbol(int row, int col, char symbol)
+{
+    game.board[row][col] = symbol;
+
+    int bit = 1 << (row * 3 + col);
+    if (symbol == 'X') {
+        game.maskX |= bit;
+    } else if (symbol == 'O') {
+        game.maskO |= bit;
+    }
+
+    // Record the move sequence for the binary game record
+    if (game.movesPlayedCount < 9) {
+        if (game.movesPlayedCount == 0) {
+            game.firstMover = symbol;
+        }
+        game.movesPlayed[game.movesPlayedCount++] = (unsigned char)(row * 3 + col);
+    }
+}
+
+/**
+ * @brief Rebuilds game.maskX / game.maskO from game.board.
+ * * Used after wholesale board changes (loading a save, restoring an undo
+ * snapshot) where moves did not flow through PlaceSymbol.
+ */
+void RebuildBoardMasks(void)
+{
+    boardToMasks(game.board, &game.maskX, &game.maskO);
 }
 
 // ============================================================================
@@ -259,6 +419,28 @@ bool CheckWinner(const char (*board)[3])
     return false;
 }
 
+/**
+ * @brief Incremental win check for the last move made at (row, col).
+ * * OPTIMIZATION: only the 2-4 winning lines through the moved cell can
+ * have been completed, so this tests just those masks on the mover's
+ * bitboard - no rescan of the char board. Winner/statistics handling
+ * matches CheckWinner.
+ */
+bool CheckWinnerAt(int row, int col)
+{
+    int pos = row * 3 + col;
+    char mover = game.board[row][col];
+    int moverMask = (mover == 'X') ? game.maskX : game.maskO;
+
+    if (mover != ' ' && isWinnerMaskAt(moverMask, pos)) {
+        game.winner = mover;
+        updateWinStatistics();
+        return true;
+    }
+
+    return false;
+}
+
 /**
  * @brief Helper function to update win statistics.
  * * This logic is separated from `CheckWinner` to keep that function
@@ -310,6 +492,23 @@ bool IsBoardFull(const char (*board)[3])
     return true;
 }
 
+/**
+ * @brief Mask-based draw check for the live game.
+ * * One compare of the combined bitboard masks against a full board
+ * (0x1FF) replaces the 9-cell scan. Draw bookkeeping matches IsBoardFull.
+ */
+bool IsBoardFullMask(void)
+{
+    if ((game.maskX | game.maskO) != 0x1FF) {
+        return false;
+    }
+
+    // Board is full - no winner, it's a draw
+    game.winner = ' '; // Ensure winner is ' ' for draw
+    game.draws++;
+    return true;
+}
+
 
 // ============================================================================
 // AI MOVE EXECUTION
@@ -322,30 +521,202 @@ bool IsBoardFull(const char (*board)[3])
  * `minimax.h` library. This keeps `game_state.c` clean and
  * independent of the complex AI logic itself.
  */
-void MakeAIMove(void)
+/**
+ * @brief Runs the difficulty-appropriate search for one position.
+ * * Pure function of its inputs so it is safe to call from the search
+ * worker thread: it never touches the global game state.
+ */
+static struct Move searchPosition(int aiMask, int oppMask,
+                                  char (*board)[3],
+                                  char aiSymbol, int difficulty)
 {
-    struct Move bestMove;
-    
     // Select AI algorithm based on difficulty setting
-    if (game.difficulty == DIFF_HARD) {
+    if (difficulty == DIFF_HARD) {
         // Perfect AI: 0% Error Rate
-        bestMove = findBestMoveMinimax(game.board, game.aiSymbol, 0);
-    } else if (game.difficulty == DIFF_MEDIUM) {
+        return findBestMoveMinimaxMasks(aiMask, oppMask, 0);
+    } else if (difficulty == DIFF_MEDIUM) {
         // Imperfect AI: 20% Forced Randomness
         // This is the "Forced Random Move" strategy
-        bestMove = findBestMoveMinimax(game.board, game.aiSymbol, 20);
-    } else {  // DIFF_EASY
-        // Model-based AI - uses logistic regression evaluation
-        bestMove = findBestMoveModel(game.board, game.aiSymbol);
+        return findBestMoveMinimaxMasks(aiMask, oppMask, 20);
     }
-    
+    // DIFF_EASY: Model-based AI - uses logistic regression evaluation
+    return findBestMoveModel(board, aiSymbol);
+}
+
+void ApplyAIMove(struct Move bestMove)
+{
     // Apply AI move to board if valid
     if (bestMove.row != -1 && bestMove.col != -1) {
-        game.board[bestMove.row][bestMove.col] = game.aiSymbol;
+        // Tag the reply as byAI so undo pops it with the human move below it
+        PushMoveDelta(bestMove.row, bestMove.col, game.aiSymbol, true);
+        PlaceSymbol(bestMove.row, bestMove.col, game.aiSymbol);
         game.currentPlayer = game.humanSymbol;  // Switch back to human
     }
 }
 
+void PushMoveDelta(int row, int col, char symbol, bool byAI)
+{
+    if (game.moveCount >= game.moveCapacity) {
+        return; // Arena exhausted (cannot happen in a 9-ply game)
+    }
+
+    MoveDelta *delta = &game.moveHistory[game.moveCount++];
+    delta->cell = (unsigned char)(row * 3 + col);
+    delta->symbol = symbol;
+    delta->prevPlayer = game.currentPlayer;
+    delta->prevAiTurn = game.aiTurn;
+    delta->byAI = byAI;
+}
+
+bool UndoLastMove(void)
+{
+    if (game.moveCount <= 0) {
+        return false;
+    }
+
+    // Pop any AI replies sitting on top, then the human move under them,
+    // so one undo always hands the turn back to the human.
+    MoveDelta delta;
+    do {
+        delta = game.moveHistory[--game.moveCount];
+
+        int bit = 1 << delta.cell;
+        game.board[delta.cell / 3][delta.cell % 3] = ' ';
+        if (delta.symbol == 'X') {
+            game.maskX &= ~bit;
+        } else {
+            game.maskO &= ~bit;
+        }
+    } while (delta.byAI && game.moveCount > 0);
+
+    // The oldest popped delta holds the turn state the game had before it
+    game.currentPlayer = delta.prevPlayer;
+    game.aiTurn = delta.prevAiTurn;
+    game.movesPlayedCount = countBits(game.maskX | game.maskO);
+
+    // Undoing past a finished position reopens the game
+    game.gameOver = false;
+    game.winner = ' ';
+    game.saveMessageTimer = 0.0f;
+
+    // Any search submitted for the undone position is now stale
+    CancelAIMoveSearch();
+    return true;
+}
+
+struct Move MakeAIMove(void)
+{
+    // The minimax AIs search directly on the authoritative GameState
+    // masks - no per-call boardToMasks conversion of the char board.
+    int aiMask, oppMask;
+    getPlayerMasks(game.maskX, game.maskO, game.aiSymbol, &aiMask, &oppMask);
+
+    struct Move bestMove = searchPosition(aiMask, oppMask, game.board,
+                                          game.aiSymbol, game.difficulty);
+    ApplyAIMove(bestMove);
+    return bestMove;
+}
+
+// ----------------------------------------------------------------------------
+// Asynchronous AI search
+// ----------------------------------------------------------------------------
+// OPTIMIZATION: The search used to run synchronously inside the frame
+// loop, hidden only by the cosmetic aiMoveTimer delay. It now runs on a
+// one-shot worker thread: HandleGameScreen submits the position when the
+// AI turn starts (so the search overlaps the thinking delay), polls the
+// status each frame, and applies the result once both the search and the
+// delay have finished. The render thread never blocks on the search.
+
+/**
+ * @brief Position snapshot handed to the worker thread.
+ * * The worker only reads this copy, never the live game state, so the
+ * render thread can keep mutating timers and UI state while it runs.
+ */
+typedef struct {
+    int aiMask;            // AI bitboard at submit time
+    int oppMask;           // Opponent bitboard at submit time
+    char board[3][3];      // Char board copy (for the model AI)
+    char aiSymbol;
+    int difficulty;       // DIFF_EASY / DIFF_MEDIUM / DIFF_HARD
+    struct Move result;    // Written by the worker before done is set
+} AISearchJob;
+
+static AISearchJob aiJob;
+static pthread_t aiThread;
+static bool aiJobRunning = false;        // Worker thread live, needs a join
+static bool aiResultValid = false;       // Result harvested, not yet taken
+static volatile bool aiJobDone = false;  // Set by the worker when finished
+
+static void *aiSearchWorker(void *arg)
+{
+    AISearchJob *job = (AISearchJob *)arg;
+    job->result = searchPosition(job->aiMask, job->oppMask, job->board,
+                                 job->aiSymbol, job->difficulty);
+    aiJobDone = true;
+    return NULL;
+}
+
+bool SubmitAIMoveSearch(void)
+{
+    if (aiJobRunning || aiResultValid) {
+        return false; // A search for this turn is already in flight
+    }
+
+    getPlayerMasks(game.maskX, game.maskO, game.aiSymbol,
+                   &aiJob.aiMask, &aiJob.oppMask);
+    memcpy(aiJob.board, game.board, sizeof(aiJob.board));
+    aiJob.aiSymbol = game.aiSymbol;
+    aiJob.difficulty = game.difficulty;
+
+    aiJobDone = false;
+    if (pthread_create(&aiThread, NULL, aiSearchWorker, &aiJob) != 0) {
+        return false; // Caller falls back to the synchronous MakeAIMove
+    }
+    aiJobRunning = true;
+    return true;
+}
+
+AISearchStatus GetAISearchStatus(void)
+{
+    if (aiResultValid) {
+        return AI_SEARCH_READY;
+    }
+    if (aiJobRunning) {
+        if (!aiJobDone) {
+            return AI_SEARCH_RUNNING;
+        }
+        // Worker finished: reclaim the thread and keep the result
+        pthread_join(aiThread, NULL);
+        aiJobRunning = false;
+        aiResultValid = true;
+        return AI_SEARCH_READY;
+    }
+    return AI_SEARCH_IDLE;
+}
+
+bool TakeAIMoveResult(struct Move *move)
+{
+    if (GetAISearchStatus() != AI_SEARCH_READY) {
+        return false;
+    }
+    *move = aiJob.result;
+    aiResultValid = false;
+    return true;
+}
+
+void CancelAIMoveSearch(void)
+{
+    // The position the search was submitted for no longer exists
+    // (new game, loaded save, undo) - wait it out and drop the result.
+    // A 3x3 search finishes in microseconds, so the join is painless.
+    if (aiJobRunning) {
+        pthread_join(aiThread, NULL);
+        aiJobRunning = false;
+    }
+    aiResultValid = false;
+    aiJobDone = false;
+}
+
 // ============================================================================
 // THEME MANAGEMENT
 // ============================================================================
@@ -378,113 +749,395 @@ void ChangeTheme(ThemeID newTheme) {
 // ============================================================================
 
 /**
- * @brief Saves the *entire* GameState struct to a binary file.
- * * This uses `fwrite` to write the raw bytes of the `game` struct
- * directly to "save.dat". This is simple but has drawbacks:
- * 1. Not portable (byte order, struct padding).
- * 2. Fragile: If `GameState` struct changes, old saves are invalid.
- * * It also sets a UI message (`game.saveMessage`) to give the user
- * feedback on the operation.
+ * The save format is a small versioned envelope around only the actual
+ * game data - no live pointers, Sound handles, or UI timers, which is
+ * what made the old whole-struct fwrite fragile. Layout on disk:
+ *
+ *   SaveHeader  { magic, version, payload size, checksum }
+ *   SavePayload { masks, symbols, mode/difficulty, status, stats }
+ *
+ * Writes go to a temporary file which is renamed over "save.dat" only
+ * after a successful write, so a crash mid-save never corrupts an
+ * existing save. The payload is ~30 bytes, making save/load cheap enough
+ * to run on every move.
  */
-void SaveGame(void) {
-    FILE* file = fopen("save.dat", "wb");
+
+#define SAVE_FILE_NAME "save.dat"
+#define SAVE_TEMP_NAME "save.dat.tmp"
+#define SAVE_MAGIC 0x53545454u  // "TTTS" (Tic-Tac-Toe Save)
+#define SAVE_VERSION 1
+
+typedef struct {
+    unsigned int magic;         // SAVE_MAGIC
+    unsigned short version;     // SAVE_VERSION
+    unsigned short payloadSize; // sizeof(SavePayload) when written
+    unsigned int checksum;      // FNV-1a over the payload bytes
+} SaveHeader;
+
+typedef struct {
+    unsigned short maskX;       // Board as bitmasks (board is re-derived)
+    unsigned short maskO;
+    unsigned char mode;
+    unsigned char difficulty;
+    char humanSymbol;
+    char aiSymbol;
+    char currentPlayer;
+    unsigned char gameOver;
+    char winner;
+    unsigned char aiTurn;
+    unsigned char currentTheme;
+    int player1Wins;
+    int player2Wins;
+    int draws;
+} SavePayload;
+
+// Forward declarations for the write-behind journal (defined below the
+// history code it also serves); both return false when the journal is
+// not running so callers can fall back to an inline write.
+static bool journalQueueSave(const SaveHeader *header,
+                             const SavePayload *payload);
+static bool journalQueueHistoryLine(const char *line);
+
+/**
+ * @brief FNV-1a checksum over a byte buffer (detects torn/corrupt saves).
+ */
+static unsigned int saveChecksum(const void *data, size_t size)
+{
+    const unsigned char *bytes = (const unsigned char *)data;
+    unsigned int hash = 2166136261u;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+/**
+ * @brief Forces a file's buffered data down to the storage device.
+ */
+static void journalSyncFile(FILE *file)
+{
+    fflush(file);
+#ifdef _WIN32
+    _commit(_fileno(file));
+#else
+    fsync(fileno(file));
+#endif
+}
+
+/**
+ * @brief Writes one save (header + payload) to disk atomically.
+ * * Temp file plus rename, so a crash mid-write never corrupts an
+ * existing save. Called from the journal writer thread (with sync, the
+ * journal's durability point) and from SaveGame's inline fallback.
+ */
+static bool writeSaveFile(const SaveHeader *header,
+                          const SavePayload *payload, bool sync)
+{
+    FILE* file = fopen(SAVE_TEMP_NAME, "wb");
     if (file == NULL) {
+        return false;
+    }
+
+    size_t written = fwrite(header, sizeof(SaveHeader), 1, file);
+    written += fwrite(payload, sizeof(SavePayload), 1, file);
+    if (written == 2 && sync) {
+        journalSyncFile(file);
+    }
+    fclose(file);
+
+    if (written != 2) {
+        remove(SAVE_TEMP_NAME); // Incomplete write - discard, keep old save
+        return false;
+    }
+
+    // Atomic publish: the old save stays intact until the new one is
+    // fully on disk. (remove first - rename won't overwrite on Windows.)
+    remove(SAVE_FILE_NAME);
+    return rename(SAVE_TEMP_NAME, SAVE_FILE_NAME) == 0;
+}
+
+/**
+ * @brief Saves the current game as a compact versioned record.
+ * * Writes header + payload to a temp file and renames it over the real
+ * save, so the operation is atomic. Sets a UI message
+ * (`game.saveMessage`) to give the user feedback on the operation.
+ */
+void SaveGame(void) {
+    SavePayload payload = {0};
+    payload.maskX = (unsigned short)game.maskX;
+    payload.maskO = (unsigned short)game.maskO;
+    payload.mode = (unsigned char)game.mode;
+    payload.difficulty = (unsigned char)game.difficulty;
+    payload.humanSymbol = game.humanSymbol;
+    payload.aiSymbol = game.aiSymbol;
+    payload.currentPlayer = game.currentPlayer;
+    payload.gameOver = game.gameOver ? 1 : 0;
+    payload.winner = game.winner;
+    payload.aiTurn = game.aiTurn ? 1 : 0;
+    payload.currentTheme = (unsigned char)game.currentTheme;
+    payload.player1Wins = game.player1Wins;
+    payload.player2Wins = game.player2Wins;
+    payload.draws = game.draws;
+
+    SaveHeader header;
+    header.magic = SAVE_MAGIC;
+    header.version = SAVE_VERSION;
+    header.payloadSize = (unsigned short)sizeof(SavePayload);
+    header.checksum = saveChecksum(&payload, sizeof(SavePayload));
+
+    // OPTIMIZATION: Queue the snapshot for the background writer instead
+    // of blocking this frame on disk. Snapshots coalesce - an autosave
+    // per move costs one queue copy here and at most one disk write per
+    // flush window on the writer.
+    if (journalQueueSave(&header, &payload)) {
+        game.saveMessage = "Game Saved!";
+        game.saveMessageTimer = 2.0f;
+        return;
+    }
+
+    // Journal not running: write inline as before
+    if (!writeSaveFile(&header, &payload, false)) {
         // OPTIMIZATION: Direct string assignment instead of strcpy
         game.saveMessage = "ERROR: Save Failed!";
         game.saveMessageTimer = 2.0f;
         return;
     }
 
-    fwrite(&game, sizeof(GameState), 1, file);
-    fclose(file);
-
     // OPTIMIZATION: Direct string assignment instead of strcpy
     game.saveMessage = "Game Saved!";
     game.saveMessageTimer = 2.0f;
 }
 
 /**
- * @brief Loads the GameState from "save.dat".
- * * This function contains critical safety logic to prevent crashes.
- * * 1. It remembers the user's *current* theme.
- * 2. It reads the file into a *temporary* `tempGame` struct, NOT the
- * live `game` struct.
- * 3. It *validates* the read (`itemsRead == 1`). If the file is empty or
- * corrupt, it aborts, leaving the current game state untouched.
- * 4. Only on success does it copy `tempGame` into the global `game`.
- * 5. It *restores* the user's original theme (a design choice).
- * 6. It *must* call `ChangeTheme` to re-apply the theme's colors,
- * as the global `Color` variables are not part of the saved struct.
+ * @brief Loads the game from "save.dat".
+ * * Validation happens before anything touches the live `game` state:
+ * the header magic, version and payload size must match, and the
+ * payload checksum must verify - so truncated or corrupted files (and
+ * old whole-struct saves) are rejected cleanly. Only the actual game
+ * data is applied; UI state, sounds and the active theme are untouched.
  */
 bool LoadGame(void)
 {
-    // 1. Remember the user's currently active theme
-    ThemeID currentThemeBeforeLoad = game.currentTheme;
+    // A save queued behind the journal is newer than the file on disk
+    JournalFlush();
 
-    FILE* file = fopen("save.dat", "rb"); // "rb" = Read Binary
+    FILE* file = fopen(SAVE_FILE_NAME, "rb"); // "rb" = Read Binary
     if (file == NULL) {
         return false; // No save file found
     }
 
-    // 2. Read into a temporary variable, NOT the real 'game'
-    GameState tempGame;
-    size_t itemsRead = fread(&tempGame, sizeof(GameState), 1, file);
+    // 1. Read and validate the envelope before touching 'game'
+    SaveHeader header;
+    if (fread(&header, sizeof(SaveHeader), 1, file) != 1 ||
+        header.magic != SAVE_MAGIC ||
+        header.version != SAVE_VERSION ||
+        header.payloadSize != sizeof(SavePayload)) {
+        fclose(file);
+        return false; // Unknown, old-format, or truncated file
+    }
+
+    SavePayload payload;
+    if (fread(&payload, sizeof(SavePayload), 1, file) != 1) {
+        fclose(file);
+        return false;
+    }
     fclose(file);
 
-    // 3. CRITICAL: Check if the read was successful.
-    // If itemsRead != 1, the file was empty or corrupted. Abort.
-    // This check prevents a crash from loading bad data.
-    if (itemsRead != 1) {
+    // 2. Checksum guards against torn writes and bit rot
+    if (saveChecksum(&payload, sizeof(SavePayload)) != header.checksum) {
         return false;
     }
 
-    // 4. Success! Now we can safely update the real 'game'
-    game = tempGame;
+    // 3. Masks must describe a legal board (no overlapping pieces)
+    if ((payload.maskX & payload.maskO) != 0 ||
+        payload.maskX > 0x1FF || payload.maskO > 0x1FF) {
+        return false;
+    }
 
-       // Reset dynamic pointers to prevent crashes
-    // (Pointers saved to disk are invalid when loaded back)
-    game.moveHistory = NULL;
+    // 4. Apply only the game data to the live state
+    game.maskX = payload.maskX;
+    game.maskO = payload.maskO;
+    game.mode = (GameMode)payload.mode;
+    game.difficulty = payload.difficulty;
+    game.humanSymbol = payload.humanSymbol;
+    game.aiSymbol = payload.aiSymbol;
+    game.currentPlayer = payload.currentPlayer;
+    game.gameOver = (payload.gameOver != 0);
+    game.winner = payload.winner;
+    game.aiTurn = (payload.aiTurn != 0);
+    game.player1Wins = payload.player1Wins;
+    game.player2Wins = payload.player2Wins;
+    game.draws = payload.draws;
+
+    // 5. Re-derive the char board from the authoritative masks
+    for (int idx = 0; idx < 9; idx++) {
+        int bit = 1 << idx;
+        if (game.maskX & bit) game.board[idx / 3][idx % 3] = 'X';
+        else if (game.maskO & bit) game.board[idx / 3][idx % 3] = 'O';
+        else game.board[idx / 3][idx % 3] = ' ';
+    }
+
+    // 6. Loaded position starts a fresh undo history / AI timer
     game.moveCount = 0;
-    game.moveCapacity = 0;
-    game.gameHistory = NULL;
-    game.historyLineCount = 0;
-    game.historyCapacity = 0;
-    
-    // 5. Restore the user's active theme (as requested)
-    game.currentTheme = currentThemeBeforeLoad;
-    
-    // 6. Re-apply the colors for the active theme
-    // This is necessary because the global Color... variables
-    // are not part of the GameState struct and were not loaded.
-    ChangeTheme(game.currentTheme);
-
-    // 7. Unload old sound effects before loading new ones (prevent memory leak)
-    UnloadSound(game.sfx.click);
-    UnloadSound(game.sfx.win);
-    UnloadSound(game.sfx.lose);
-    UnloadSound(game.sfx.draw);
-
-    // 8. Restore sound effects
-    game.sfx.click     = LoadSound("resources/click.ogg");
-    game.sfx.win       = LoadSound("resources/win.ogg");
-    game.sfx.lose      = LoadSound("resources/lose.ogg");
-    game.sfx.draw      = LoadSound("resources/draw.ogg");
-    
+    game.aiMoveTimer = 0.5f;
+    game.saveMessageTimer = 0.0f;
+
+    // The order the loaded pieces were played in is not saved, so this
+    // game can't produce a replayable record (unless the board is empty).
+    game.movesPlayedCount = 0;
+    game.firstMover = ' ';
+    game.movesKnown = ((game.maskX | game.maskO) == 0);
+
+    // Any search still running targets the pre-load position
+    CancelAIMoveSearch();
+
+    // Rebind the sound handles from the cache - a handle copy, not the
+    // four disk re-loads (and audible hitch) a restore used to cost
+    ResourceCacheBindSounds(&game.sfx);
+
     return true;
 }
 
+// ============================================================================
+// GAME HISTORY (INDEXED, LAZILY PAGED)
+// ============================================================================
+
 /**
- * @brief Appends the result of the completed game to "game_history.txt".
- * * This function is called once when a game ends.
+ * History files on long-lived installs grow to hundreds of thousands of
+ * lines, so the file is never loaded whole. LoadGameHistory makes one
+ * streaming pass recording the byte offset of each line start; the
+ * history screen then pages in only the lines around the visible window
+ * through GetHistoryLine. Appends extend the index in place.
  */
-void AppendGameToHistory(void)
+
+#define HISTORY_FILE_NAME "game_history.txt"
+#define HISTORY_PAGE_LINES 64   // Lines kept resident around the view
+
+/**
+ * @brief Records one line-start offset in the index (growing it as needed).
+ */
+static void recordHistoryOffset(long offset)
 {
-    // "a" mode = append (or create if it doesn't exist)
-    FILE* file = fopen("game_history.txt", "a");
+    if (game.historyLineCount >= game.historyIndexCapacity) {
+        int newCapacity = (game.historyIndexCapacity == 0) ? 256 : game.historyIndexCapacity * 2;
+        long *newIndex = (long *)realloc(game.historyIndex, newCapacity * sizeof(long));
+
+        if (newIndex == NULL) {
+            return; // realloc failed - old index is still valid, drop the line
+        }
+
+        game.historyIndex = newIndex;
+        game.historyIndexCapacity = newCapacity;
+    }
+
+    game.historyIndex[game.historyLineCount++] = offset;
+}
+
+/**
+ * @brief Drops the lines currently held in the page buffer.
+ * * The line text lives in the history arena, so this is a wholesale
+ * reset - no per-line free loop.
+ */
+static void freeHistoryPage(void)
+{
+    arenaReset(&game.historyArena);
+    game.historyPageCount = 0;
+    game.historyPageStart = 0;
+}
+
+/**
+ * @brief Loads a page of lines starting at firstLine into the buffer.
+ * * One fseek to the indexed offset, then sequential fgets - the page is
+ * contiguous in the file. Replaces whatever page was loaded before.
+ */
+static void loadHistoryPage(int firstLine)
+{
+    if (firstLine < 0) firstLine = 0;
+    if (firstLine >= game.historyLineCount) return;
+
+    // Ensure the page buffer array exists
+    if (game.historyCapacity < HISTORY_PAGE_LINES) {
+        char **newHistory = (char **)realloc(game.gameHistory, HISTORY_PAGE_LINES * sizeof(char *));
+        if (newHistory == NULL) {
+            return;
+        }
+        game.gameHistory = newHistory;
+        game.historyCapacity = HISTORY_PAGE_LINES;
+    }
+
+    freeHistoryPage();
+
+    // Size the arena for a worst-case page (every line at max length)
+    // while it is empty, so the per-line allocations below cannot fail
+    // by needing to grow mid-page.
+    if (!arenaEnsure(&game.historyArena, HISTORY_PAGE_LINES * 128)) {
+        return;
+    }
+
+    FILE* file = fopen(HISTORY_FILE_NAME, "r");
     if (file == NULL) {
-        return; // Failed to open file, do nothing
+        return;
     }
 
+    if (fseek(file, game.historyIndex[firstLine], SEEK_SET) != 0) {
+        fclose(file);
+        return;
+    }
+
+    int wanted = game.historyLineCount - firstLine;
+    if (wanted > HISTORY_PAGE_LINES) wanted = HISTORY_PAGE_LINES;
+
+    char buffer[128];
+    game.historyPageStart = firstLine;
+    while (game.historyPageCount < wanted && fgets(buffer, 128, file) != NULL) {
+        // Remove newline character
+        buffer[strcspn(buffer, "\n")] = 0;
+
+        char *line = (char *)arenaAlloc(&game.historyArena, strlen(buffer) + 1);
+        if (line == NULL) {
+            break;
+        }
+        strcpy(line, buffer);
+        game.gameHistory[game.historyPageCount++] = line;
+    }
+
+    fclose(file);
+}
+
+const char *GetHistoryLine(int lineIndex)
+{
+    if (lineIndex < 0 || lineIndex >= game.historyLineCount) {
+        return "";
+    }
+
+    // Page miss: refill the buffer with the requested line a quarter of
+    // the way in, so scrolling either direction stays within the page.
+    if (lineIndex < game.historyPageStart ||
+        lineIndex >= game.historyPageStart + game.historyPageCount) {
+        loadHistoryPage(lineIndex - HISTORY_PAGE_LINES / 4);
+    }
+
+    if (lineIndex >= game.historyPageStart &&
+        lineIndex < game.historyPageStart + game.historyPageCount) {
+        return game.gameHistory[lineIndex - game.historyPageStart];
+    }
+
+    return ""; // Page load failed (I/O error, allocation failure)
+}
+
+/**
+ * @brief Appends the result of the completed game to "game_history.txt".
+ * * This function is called once when a game ends. If the line-offset
+ * index has been built, the new line is indexed in place - no rescan,
+ * and the loaded page stays valid. The full move sequence also goes to
+ * the binary record file for replay and large-scale analysis.
+ */
+void AppendGameToHistory(void)
+{
+    // Binary record alongside the human-readable log
+    AppendGameRecord();
+
     char summary[128];
 
     if (game.mode == MODE_ONE_PLAYER)
@@ -515,50 +1168,68 @@ void AppendGameToHistory(void)
         }
     }
 
-    fprintf(file, "%s\n", summary);
-    fclose(file);
+    // OPTIMIZATION: Hand the line to the background writer - a queue
+    // copy instead of an open/write/close right at game end. Falls back
+    // to an inline append when the journal is off or its queue is full.
+    if (!journalQueueHistoryLine(summary)) {
+        // "a" mode = append (or create if it doesn't exist)
+        FILE* file = fopen(HISTORY_FILE_NAME, "a");
+        if (file == NULL) {
+            return; // Failed to open file, do nothing
+        }
+        fprintf(file, "%s\n", summary);
+        fclose(file);
+    }
+
+    // OPTIMIZATION: Extend the index in place instead of rescanning.
+    // Only valid if the index has been built this session; otherwise
+    // LoadGameHistory will pick the line up on its next full scan.
+    if (game.historyIndex != NULL) {
+        recordHistoryOffset(game.historyFileSize);
+        game.historyFileSize += (long)strlen(summary) + 1; // +1 for '\n'
+    }
 }
 
 /**
- * @brief OPTIMIZATION: Loads game history from file using dynamic allocation.
- * Reads "game_history.txt" and allocates memory for each line.
- * Grows the array dynamically as needed using realloc.
+ * @brief OPTIMIZATION: Builds the line-offset index with one streaming pass.
+ * * Only byte offsets are recorded - no line content is allocated here,
+ * so opening the history screen stays cheap no matter how large the
+ * file has grown. Lines are paged in later by GetHistoryLine.
  */
 void LoadGameHistory(void) {
+    // Lines still queued behind the journal belong in the index too
+    JournalFlush();
+
+    // Invalidate any previously loaded page and index
+    freeHistoryPage();
     game.historyLineCount = 0;
-    
-    FILE* file = fopen("game_history.txt", "r");
+    game.historyFileSize = 0;
+
+    FILE* file = fopen(HISTORY_FILE_NAME, "rb");
     if (file == NULL) {
         return;
     }
-    
-    char buffer[128];
-    while (fgets(buffer, 128, file) != NULL) {
-        // OPTIMIZATION: Expand capacity if needed using realloc
-        if (game.historyLineCount >= game.historyCapacity) {
-            int newCapacity = (game.historyCapacity == 0) ? 10 : game.historyCapacity * 2;
-            char **newHistory = (char **)realloc(game.gameHistory, newCapacity * sizeof(char *));
-            
-            if (newHistory == NULL) {
-                // realloc failed - old pointer is still valid, just stop loading
-                break;
+
+    // Stream through the file in blocks, recording line-start offsets
+    char buffer[4096];
+    long offset = 0;
+    bool atLineStart = true;
+    size_t bytesRead;
+
+    while ((bytesRead = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        for (size_t i = 0; i < bytesRead; i++) {
+            if (atLineStart) {
+                recordHistoryOffset(offset + (long)i);
+                atLineStart = false;
+            }
+            if (buffer[i] == '\n') {
+                atLineStart = true;
             }
-            
-            game.gameHistory = newHistory;
-            game.historyCapacity = newCapacity;
-        }
-        
-        // Remove newline character
-        buffer[strcspn(buffer, "\n")] = 0;
-        
-        // OPTIMIZATION: Allocate exact size needed for this string
-        game.gameHistory[game.historyLineCount] = (char *)malloc(strlen(buffer) + 1);
-        if (game.gameHistory[game.historyLineCount] != NULL) {
-            strcpy(game.gameHistory[game.historyLineCount], buffer);
-            game.historyLineCount++;
         }
+        offset += (long)bytesRead;
     }
-    
+
+    game.historyFileSize = offset;
     fclose(file);
 }
 
@@ -567,29 +1238,243 @@ void LoadGameHistory(void) {
  * Frees all dynamically allocated strings and resets counters.
  */
 void ClearGameHistory(void) {
-    FILE* file = fopen("game_history.txt", "w");
+    // A queued line must not land after the truncate
+    JournalFlush();
+
+    FILE* file = fopen(HISTORY_FILE_NAME, "w");
     if (file != NULL) {
         fclose(file);
     }
-    
-    // OPTIMIZATION: Free all allocated strings
+
+    // The binary game records mirror the text history, so clear both
+    remove(GAME_RECORD_FILE);
+
+    // OPTIMIZATION: Free the loaded page and the line-offset index
+    freeHistoryPage();
     if (game.gameHistory != NULL) {
-        for (int i = 0; i < game.historyLineCount; i++) {
-            free(game.gameHistory[i]);
-        }
         free(game.gameHistory);
         game.gameHistory = NULL;
     }
+    if (game.historyIndex != NULL) {
+        free(game.historyIndex);
+        game.historyIndex = NULL;
+    }
     game.historyLineCount = 0;
     game.historyCapacity = 0;
+    game.historyIndexCapacity = 0;
+    game.historyFileSize = 0;
     game.historyScrollOffset = 0;
 }
 
 
+// ============================================================================
+// WRITE-BEHIND JOURNAL (BACKGROUND I/O)
+// ============================================================================
+// OPTIMIZATION: Game-end history appends and per-move autosaves used to
+// hit the disk synchronously from the frame loop, and on slow flash
+// storage those writes dropped frames exactly when the player was
+// interacting. Both now queue in memory and a background writer flushes
+// them with group commit: it collects everything queued within one
+// flush window, writes it in a single batch, and fsyncs. Gameplay-thread
+// cost falls to a queue copy; at most one flush window of data is at
+// risk on power failure. Save snapshots coalesce (only the newest
+// matters), so autosave-per-move costs one disk write per window, not
+// one per move.
+
+#define JOURNAL_HISTORY_SLOTS 16      // Queued history lines (ring buffer)
+#define JOURNAL_FLUSH_WINDOW_MS 250   // Group-commit window = max data loss
+
+static char journalLines[JOURNAL_HISTORY_SLOTS][128];
+static int journalLineHead = 0;       // Oldest queued line
+static int journalLineCount = 0;
+
+// Pending save snapshot, coalesced: a newer save overwrites it in place
+static SaveHeader journalSaveHeader;
+static SavePayload journalSavePayload;
+static bool journalSavePending = false;
+
+static pthread_t journalThread;
+static pthread_mutex_t journalLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t journalWork = PTHREAD_COND_INITIALIZER; // queued/stop
+static pthread_cond_t journalIdle = PTHREAD_COND_INITIALIZER; // fully drained
+static bool journalRunning = false;
+static bool journalStopRequested = false;
+static bool journalFlushRequested = false; // Skip the window, commit now
+static bool journalWriting = false;        // Writer mid-commit (lock dropped)
+
+/**
+ * @brief The background writer: wait, batch, commit, repeat.
+ * * After the first entry arrives it sleeps out the rest of the flush
+ * window so a burst (autosave every move of an AI exchange) lands as one
+ * commit. The queue is snapshotted under the lock and written without
+ * it, so gameplay-thread pushes never wait on the disk.
+ */
+static void *journalWriter(void *arg)
+{
+    (void)arg;
+    pthread_mutex_lock(&journalLock);
+    while (true) {
+        while (!journalStopRequested && !journalFlushRequested &&
+               journalLineCount == 0 && !journalSavePending) {
+            pthread_cond_wait(&journalWork, &journalLock);
+        }
+        if (journalLineCount == 0 && !journalSavePending) {
+            if (journalStopRequested) {
+                break; // Drained and asked to stop
+            }
+            journalFlushRequested = false; // Nothing to flush
+            pthread_cond_broadcast(&journalIdle);
+            continue;
+        }
+
+        // Group commit: let the rest of the flush window accumulate more
+        // entries, unless someone needs durability right now
+        if (!journalStopRequested && !journalFlushRequested) {
+            struct timespec deadline;
+            clock_gettime(CLOCK_REALTIME, &deadline);
+            deadline.tv_nsec += JOURNAL_FLUSH_WINDOW_MS * 1000000L;
+            if (deadline.tv_nsec >= 1000000000L) {
+                deadline.tv_sec += 1;
+                deadline.tv_nsec -= 1000000000L;
+            }
+            while (!journalStopRequested && !journalFlushRequested) {
+                if (pthread_cond_timedwait(&journalWork, &journalLock,
+                                           &deadline) == ETIMEDOUT) {
+                    break;
+                }
+            }
+        }
+
+        // Snapshot the batch and release the lock for the disk writes
+        char lines[JOURNAL_HISTORY_SLOTS][128];
+        int lineTotal = 0;
+        while (journalLineCount > 0) {
+            memcpy(lines[lineTotal++], journalLines[journalLineHead],
+                   sizeof(lines[0]));
+            journalLineHead = (journalLineHead + 1) % JOURNAL_HISTORY_SLOTS;
+            journalLineCount--;
+        }
+        bool commitSave = journalSavePending;
+        SaveHeader header = journalSaveHeader;
+        SavePayload payload = journalSavePayload;
+        journalSavePending = false;
+        journalWriting = true;
+        pthread_mutex_unlock(&journalLock);
+
+        // One append session for the whole batch of history lines
+        if (lineTotal > 0) {
+            FILE* file = fopen(HISTORY_FILE_NAME, "a");
+            if (file != NULL) {
+                for (int i = 0; i < lineTotal; i++) {
+                    fprintf(file, "%s\n", lines[i]);
+                }
+                journalSyncFile(file);
+                fclose(file);
+            }
+        }
+        if (commitSave) {
+            writeSaveFile(&header, &payload, true);
+        }
+
+        pthread_mutex_lock(&journalLock);
+        journalWriting = false;
+        if (journalLineCount == 0 && !journalSavePending) {
+            journalFlushRequested = false;
+            pthread_cond_broadcast(&journalIdle);
+        }
+    }
+    pthread_mutex_unlock(&journalLock);
+    return NULL;
+}
+
+static bool journalQueueHistoryLine(const char *line)
+{
+    if (!journalRunning) {
+        return false; // Journal off: caller writes inline
+    }
+
+    pthread_mutex_lock(&journalLock);
+    if (journalLineCount >= JOURNAL_HISTORY_SLOTS) {
+        // Writer stalled and the ring is full; don't drop the line
+        pthread_mutex_unlock(&journalLock);
+        return false;
+    }
+    int slot = (journalLineHead + journalLineCount) % JOURNAL_HISTORY_SLOTS;
+    snprintf(journalLines[slot], sizeof(journalLines[slot]), "%s", line);
+    journalLineCount++;
+    pthread_cond_signal(&journalWork);
+    pthread_mutex_unlock(&journalLock);
+    return true;
+}
+
+static bool journalQueueSave(const SaveHeader *header,
+                             const SavePayload *payload)
+{
+    if (!journalRunning) {
+        return false; // Journal off: caller writes inline
+    }
+
+    pthread_mutex_lock(&journalLock);
+    journalSaveHeader = *header;   // Coalesce: newest snapshot wins
+    journalSavePayload = *payload;
+    journalSavePending = true;
+    pthread_cond_signal(&journalWork);
+    pthread_mutex_unlock(&journalLock);
+    return true;
+}
+
+void JournalStart(void)
+{
+    if (journalRunning) {
+        return;
+    }
+    journalStopRequested = false;
+    journalFlushRequested = false;
+    // If the thread can't start, journalRunning stays false and every
+    // write takes the inline path - slower, but nothing is lost
+    if (pthread_create(&journalThread, NULL, journalWriter, NULL) == 0) {
+        journalRunning = true;
+    }
+}
+
+void JournalFlush(void)
+{
+    if (!journalRunning) {
+        return; // Inline writes are already durable
+    }
+
+    pthread_mutex_lock(&journalLock);
+    journalFlushRequested = true;
+    pthread_cond_signal(&journalWork);
+    while (journalLineCount > 0 || journalSavePending || journalWriting) {
+        pthread_cond_wait(&journalIdle, &journalLock);
+    }
+    pthread_mutex_unlock(&journalLock);
+}
+
+void JournalShutdown(void)
+{
+    if (!journalRunning) {
+        return;
+    }
+
+    pthread_mutex_lock(&journalLock);
+    journalStopRequested = true;
+    pthread_cond_signal(&journalWork);
+    pthread_mutex_unlock(&journalLock);
+
+    // The writer drains everything still queued before it exits
+    pthread_join(journalThread, NULL);
+    journalRunning = false;
+}
+
 void DeleteSaveGame(void)
 {
+    // A queued save must not resurrect the file after the delete
+    JournalFlush();
+
     // Try to delete "save.dat"
-    if (remove("save.dat") == 0) 
+    if (remove("save.dat") == 0)
     {
         game.saveMessage = "Save Deleted!";
         game.saveMessageTimer = 2.0f;
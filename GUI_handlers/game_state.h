@@ -13,6 +13,7 @@
 #define GAME_STATE_H
 
 #include "raylib.h"
+#include "../Game_algorithms/minimax.h" // For struct Move
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -82,6 +83,7 @@ typedef enum {
     SCREEN_SYMBOL_SELECT_2P,   // Choose who goes first (2P)
     SCREEN_INSTRUCTIONS,       // How to play
     SCREEN_HISTORY,            // View game history
+    SCREEN_REPLAY,             // Step through a recorded game
     SCREEN_GAME,               // The actual game
     SCREEN_GAME_OVER           // Game ended
 } GameScreen;
@@ -105,14 +107,36 @@ typedef enum {
 // ============================================================================
 
 /**
- * @brief Stores the state of the game board for each move.
- * Used by the Undo button to restore previous game states.
+ * @brief One move's worth of undo/replay information.
+ *
+ * OPTIMIZATION: Undo used to snapshot the whole board (plus turn state)
+ * for every move. A move changes exactly one cell, so a delta records
+ * just the cell played, the symbol placed, and the turn flags in effect
+ * before the move - a few bytes per entry instead of a full board copy.
+ * Undoing clears the one cell and restores the flags; the replay screen
+ * reconstructs any position by applying the first N deltas.
  */
 typedef struct {
-    char board[3][3];
-    char currentPlayer;
-    bool aiTurn;
-} MoveSnapshot;
+    unsigned char cell; // Position played (row * 3 + col)
+    char symbol;        // Symbol placed ('X' or 'O')
+    char prevPlayer;    // game.currentPlayer before the move
+    bool prevAiTurn;    // game.aiTurn before the move
+    bool byAI;          // AI reply; undo pops it together with the
+                        // human move beneath it
+} MoveDelta;
+
+/**
+ * @brief OPTIMIZATION: Arena (bump) allocator for small allocations.
+ * * One backing block; allocations just advance `used`, and the whole
+ * arena is recycled by resetting `used` to 0 instead of freeing each
+ * allocation. Long kiosk sessions stop churning the heap with thousands
+ * of tiny malloc/free pairs (move snapshots, history line strings).
+ */
+typedef struct {
+    char *block;     // Single backing allocation
+    size_t capacity; // Bytes available in block
+    size_t used;     // Bump offset; reset to recycle wholesale
+} Arena;
 
 typedef struct {
     Sound click;
@@ -147,6 +171,13 @@ typedef struct {
     
     // Board & Player State
     char board[3][3];       // a nested 3x3 array representing the Tic-Tac-Toe board - stores 'X', 'O', or ' ' (empty)
+
+    // OPTIMIZATION: Authoritative bitboard masks (bit = row * 3 + col),
+    // updated incrementally by PlaceSymbol. Win/draw checks become single
+    // bit tests and the AI can search without converting the char board.
+    int maskX;              // bitmask of X pieces
+    int maskO;              // bitmask of O pieces
+
     char humanSymbol;       // variable to store the human player's selected symbol ('X' or 'O')
     char aiSymbol;          // variable to store the AI player's symbol ('X' or 'O')
     char currentPlayer;     // variable to track whose turn it is ('X' or 'O')
@@ -177,51 +208,93 @@ typedef struct {
 
     // --- OPTIMIZED Undo System ---
     /**
-     * @brief OPTIMIZATION: Dynamic array to store game state history.
-     * Allocated using malloc/realloc only when moves are made.
+     * @brief OPTIMIZATION: Delta stack for undo, shared with replay.
+     * One compact MoveDelta per ply instead of full-board snapshots.
      */
-    MoveSnapshot *moveHistory;  // Dynamic array (replaces fixed moveHistory[9])
-    
+    MoveDelta *moveHistory;
+
     /**
-     * @brief The number of moves currently stored in moveHistory.
+     * @brief The number of deltas currently stored in moveHistory.
      * This acts as a stack pointer for our history.
      */
     int moveCount;
 
     /**
      * @brief OPTIMIZATION: Tracks allocated capacity of moveHistory array.
-     * Allows us to grow the array dynamically with realloc.
+     * Sized once per game from the move arena (no mid-game realloc).
      */
     int moveCapacity;
 
+    /**
+     * @brief OPTIMIZATION: Per-game arena backing moveHistory.
+     * Reset wholesale by ResetBoard instead of freed/reallocated.
+     */
+    Arena moveArena;
+
 
-    // --- OPTIMIZED History System ---
+    // --- OPTIMIZED History System (indexed, lazily paged) ---
     /**
-     * @brief OPTIMIZATION: Dynamic 2D array to hold game history lines read from file.
-     * Each element is a dynamically allocated string.
+     * @brief OPTIMIZATION: Page buffer holding only the lines around the
+     * visible window, not the whole file. Each element is a dynamically
+     * allocated string; GetHistoryLine refills the page on demand.
      */
-    char **gameHistory;         // Dynamic array of strings (replaces gameHistory[100][128])
-    
+    char **gameHistory;         // Page buffer of strings (HISTORY_PAGE_LINES max)
+
+    /**
+     * @brief OPTIMIZATION: Single-block arena holding the page's line
+     * text. The gameHistory pointers point into it; swapping pages is an
+     * arena reset, not one free+malloc per line.
+     */
+    Arena historyArena;
+
     /**
-     * @brief Number of lines currently in gameHistory.
+     * @brief Total number of lines in game_history.txt (from the index).
      */
     int historyLineCount;
-    
+
     /**
      * @brief OPTIMIZATION: Tracks allocated capacity of gameHistory array.
-     * Allows unlimited history without wasting memory.
      */
     int historyCapacity;
-    
+
     // Tracks the scroll position (index of the top visible line)
-    int historyScrollOffset; 
+    int historyScrollOffset;
+
+    /**
+     * @brief OPTIMIZATION: Byte offset of each line start in
+     * game_history.txt. Built by one streaming scan in LoadGameHistory;
+     * lets any line be fetched with a single fseek instead of holding
+     * the whole file resident.
+     */
+    long *historyIndex;
+    int historyIndexCapacity;   // Allocated entries in historyIndex
+    long historyFileSize;       // End-of-file offset (for O(1) append indexing)
+    int historyPageStart;       // First line held in the gameHistory page buffer
+    int historyPageCount;       // Lines currently in the page buffer
 
     // Timer to control animation speed
-    float simTimer;      
+    float simTimer;
 
     // Which winning pattern to show (0 to 7)
-    int simStep;      
-        
+    int simStep;
+
+    // --- Move Sequence Recording (for binary game records) ---
+    /**
+     * @brief Cell indices (row * 3 + col) of every move this game, in
+     * play order. Appended by PlaceSymbol; AppendGameRecord bit-packs
+     * this into the 16-byte record format (see game_record.h).
+     */
+    unsigned char movesPlayed[9];
+    int movesPlayedCount;       // Plies played so far this game
+    char firstMover;            // Symbol that made the first move
+    bool movesKnown;            // false when resumed from a save (sequence lost)
+
+    // --- Replay Viewer State ---
+    int replayGameIndex;        // Record currently loaded in the viewer
+    int replayStep;             // Current ply shown (0 = empty board)
+    int replayTotalPlies;       // Plies in the loaded record
+    char replayWinner;          // Winner of the loaded record
+
 } GameState;
 
 // ============================================================================
@@ -286,13 +359,117 @@ bool CheckWinner(const char (*board)[3]); // using pointer to 2D array of 3 char
  */
 bool IsBoardFull(const char (*board)[3]);
 
+/**
+ * @brief Place a symbol on the board, keeping the bitboard masks in sync
+ * * This is the one mutation point for game.board: it writes the cell and
+ * sets the matching bit in game.maskX / game.maskO, so the incremental
+ * win checks below stay valid. All move placement (human and AI) must go
+ * through here.
+ */
+void PlaceSymbol(int row, int col, char symbol);
+
+/**
+ * @brief Rebuild game.maskX / game.maskO from game.board
+ * * Needed whenever the board is changed wholesale instead of through
+ * PlaceSymbol - loading a save, restoring an undo snapshot.
+ */
+void RebuildBoardMasks(void);
+
+/**
+ * @brief Incremental win check for the last move made at (row, col)
+ * * Tests only the 2-4 winning lines through that cell on the mover's
+ * bitboard mask - no board rescan. Updates the winner field and
+ * statistics exactly like CheckWinner when a win is found.
+ * * @return true if the move at (row, col) completed a winning line
+ */
+bool CheckWinnerAt(int row, int col);
+
+/**
+ * @brief Mask-based draw check for the live game
+ * * Single compare of the combined masks against a full board; increments
+ * the draw counter like IsBoardFull when the board is full.
+ * * @return true if the board is full
+ */
+bool IsBoardFullMask(void);
+
 /**
  * @brief Execute the AI's move based on current difficulty
- * * Acts as a dispatcher. It selects the appropriate AI algorithm 
+ * * Acts as a dispatcher. It selects the appropriate AI algorithm
  * (from Team_B's minimax.h) based on `game.difficulty` and makes a move.
- * This keeps the game state logic separate from the AI implementation.
+ * The hard/medium minimax AIs search directly on the GameState masks.
+ * * @return The move that was made ({-1, -1} if no move was possible)
+ */
+struct Move MakeAIMove(void);
+
+/**
+ * @brief Applies an already-computed AI move to the game state.
+ * * Shared tail of the synchronous and asynchronous AI paths: places the
+ * symbol (if the move is valid) and hands the turn back to the human.
+ */
+void ApplyAIMove(struct Move bestMove);
+
+/**
+ * @brief Pushes one move delta onto the undo stack.
+ * * Call before PlaceSymbol, so the delta captures the turn flags still
+ * in effect. Allocation-free: the entry lands in the per-game arena
+ * array sized by ResetBoard (silently dropped if that allocation
+ * failed, in which case undo is simply unavailable).
+ * * @param row Board row of the move about to be placed
+ * @param col Board column of the move
+ * @param symbol Symbol being placed
+ * @param byAI true for AI replies (undo pops them with the human move)
+ */
+void PushMoveDelta(int row, int col, char symbol, bool byAI);
+
+/**
+ * @brief Undoes back to the state before the last human move.
+ * * Pops deltas off the stack, clearing one cell (board and mask) per
+ * entry - AI replies are popped together with the human move beneath
+ * them - then restores the popped turn flags and cancels any search
+ * still targeting the abandoned position.
+ * * @return true if a move was undone, false if the stack was empty
+ */
+bool UndoLastMove(void);
+
+// ============================================================================
+// ASYNCHRONOUS AI SEARCH
+// ============================================================================
+// The search runs on a worker thread so deep searches can never hitch the
+// render loop. HandleGameScreen submits the position when the AI turn
+// starts, polls the status each frame, and takes the result once ready.
+
+typedef enum {
+    AI_SEARCH_IDLE,     // No search in flight and no unconsumed result
+    AI_SEARCH_RUNNING,  // Worker thread is still searching
+    AI_SEARCH_READY     // Result available for TakeAIMoveResult
+} AISearchStatus;
+
+/**
+ * @brief Starts a background search for the current position.
+ * * Snapshots the position so the worker never reads live game state.
+ * * @return true if the worker was started (false: one is already in
+ *         flight, or thread creation failed - fall back to MakeAIMove)
+ */
+bool SubmitAIMoveSearch(void);
+
+/**
+ * @brief Non-blocking status check for the background search.
+ */
+AISearchStatus GetAISearchStatus(void);
+
+/**
+ * @brief Takes the finished search result, clearing it for the next turn.
+ * * @param move Output move
+ * @return true if a result was available
+ */
+bool TakeAIMoveResult(struct Move *move);
+
+/**
+ * @brief Discards any in-flight search or unconsumed result.
+ * * Must be called whenever the position changes out from under a pending
+ * search (new game, loaded save, undo), or a stale move could be applied.
  */
-void MakeAIMove(void);
+void CancelAIMoveSearch(void);
 
 // Theme management
 void ChangeTheme(ThemeID newTheme);
@@ -301,10 +478,12 @@ void ChangeTheme(ThemeID newTheme);
 void SaveGame(void);
 
 /**
- * @brief Load a GameState from a binary file
- * * Reads from "save.dat" and overwrites the current `game` state.
- * Includes important safety checks to prevent crashes from
- * corrupted or empty save files.
+ * @brief Load a saved game from "save.dat"
+ * * Validates the save's magic, version and checksum before applying
+ * anything, so corrupted, truncated or old-format files are rejected
+ * without touching the current `game` state. On success only the game
+ * data (board, symbols, difficulty, stats) is restored; UI state,
+ * sounds and the active theme are left as they are.
  * * @return true if loading was successful, false otherwise
  */
 bool LoadGame(void);
@@ -314,16 +493,54 @@ bool LoadGame(void);
  */
 void DeleteSaveGame(void);
 
+// Write-behind journal: history appends and autosave snapshots queue in
+// memory and a background writer group-commits them with a periodic
+// fsync, so game-end and per-move saves never block the frame loop.
+
+/**
+ * @brief Starts the journal writer thread (called from InitGame).
+ * * If the thread cannot start, every write silently takes the old
+ * synchronous path instead - slower, but nothing is lost.
+ */
+void JournalStart(void);
+
+/**
+ * @brief Blocks until everything queued is durable on disk.
+ * * The readers (LoadGame, LoadGameHistory) and destructive operations
+ * (ClearGameHistory, DeleteSaveGame) call this so they always see the
+ * journal's writes; a no-op when the journal is not running.
+ */
+void JournalFlush(void);
+
+/**
+ * @brief Drains the queue and stops the writer (called from CleanupGame).
+ */
+void JournalShutdown(void);
+
 /**
  * @brief Appends the result of the completed game to "game_history.txt"
  */
 void AppendGameToHistory(void);
 
 /**
- * @brief Loads the game history from "game_history.txt" into the state.
+ * @brief Builds the line-offset index for "game_history.txt".
+ * * One streaming pass records where every line starts; no line content
+ * is loaded here. Call before showing the history screen - the actual
+ * text is paged in lazily by GetHistoryLine.
  */
 void LoadGameHistory(void);
 
+/**
+ * @brief Returns one history line, paging it in from disk if needed.
+ * * Lines inside the currently loaded page are returned directly; a miss
+ * seeks to the indexed offset and refills the page buffer around the
+ * requested line. Scrolling therefore costs O(visible lines), not
+ * O(total games).
+ * * @param lineIndex Line number (0 .. historyLineCount - 1)
+ * @return The line text, or "" for out-of-range indices
+ */
+const char *GetHistoryLine(int lineIndex);
+
 /**
  * @brief Clears all game history by truncating the history file.
  */
@@ -0,0 +1,199 @@
+/**
+ * @file profiler.c
+ * @brief Frame-time capture ring and debug overlay implementation
+ *
+ * Capture is deliberately dumb: three GetTime() reads per frame and one
+ * struct store into a static ring. Everything with real cost - sorting
+ * for percentiles, per-screen aggregation, text formatting - runs only
+ * in DrawProfilerOverlay while the overlay is visible, so production
+ * kiosk builds pay near-nothing until someone presses F3.
+ */
+
+#include "profiler.h"
+#include "game_state.h"
+#include "raylib.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief One frame's worth of timing data.
+ */
+typedef struct {
+    float frameMs;        // Full frame, begin-to-begin (includes pacing)
+    float handleMs;       // Handle* dispatch for the frame's screen
+    float drawMs;         // Draw* dispatch; 0 when the redraw was skipped
+    unsigned char screen; // GameScreen the frame ran on
+    unsigned char drew;   // 1 if the draw phase ran
+} ProfilerSample;
+
+// Display names indexed by GameScreen; keep in sync with game_state.h
+static const char *SCREEN_NAMES[] = {
+    "start", "mode", "theme", "difficulty", "symbol 1P", "symbol 2P",
+    "instructions", "history", "replay", "game", "game over"
+};
+#define PROFILER_NUM_SCREENS \
+    ((int)(sizeof(SCREEN_NAMES) / sizeof(SCREEN_NAMES[0])))
+
+// Ring buffer of completed frames. head is the next write slot; count
+// saturates at PROFILER_RING_FRAMES once the ring has filled.
+static ProfilerSample ring[PROFILER_RING_FRAMES];
+static int ringHead = 0;
+static int ringCount = 0;
+
+// Frame currently being timed
+static ProfilerSample pending;
+static double frameStart = 0.0; // 0 = no frame in flight
+static double phaseStart = 0.0;
+
+static bool overlayVisible = false;
+
+void ProfilerFrameBegin(void)
+{
+    double now = GetTime();
+
+    // The previous frame's total time is only known once the next frame
+    // starts, so its sample is committed here
+    if (frameStart > 0.0) {
+        pending.frameMs = (float)((now - frameStart) * 1000.0);
+        ring[ringHead] = pending;
+        ringHead = (ringHead + 1) & (PROFILER_RING_FRAMES - 1);
+        if (ringCount < PROFILER_RING_FRAMES) ringCount++;
+    }
+
+    memset(&pending, 0, sizeof(pending));
+    pending.screen = (unsigned char)game.screen;
+    frameStart = now;
+    phaseStart = now;
+
+    if (IsKeyPressed(KEY_F3)) {
+        overlayVisible = !overlayVisible;
+    }
+}
+
+void ProfilerHandlePhaseEnd(void)
+{
+    double now = GetTime();
+    pending.handleMs = (float)((now - phaseStart) * 1000.0);
+    phaseStart = now;
+}
+
+void ProfilerDrawPhaseEnd(void)
+{
+    // Measured from the end of the handle phase, so BeginDrawing and the
+    // background clear are billed to the draw side where they belong
+    pending.drawMs = (float)((GetTime() - phaseStart) * 1000.0);
+    pending.drew = 1;
+}
+
+bool ProfilerOverlayVisible(void)
+{
+    return overlayVisible;
+}
+
+void ProfilerReset(void)
+{
+    ringHead = 0;
+    ringCount = 0;
+    frameStart = 0.0;
+    phaseStart = 0.0;
+    memset(&pending, 0, sizeof(pending));
+}
+
+/**
+ * @brief qsort comparator for ascending floats.
+ */
+static int compareFloat(const void *a, const void *b)
+{
+    float fa = *(const float *)a;
+    float fb = *(const float *)b;
+    return (fa > fb) - (fa < fb);
+}
+
+void ProfilerComputeStats(ProfilerStats *stats)
+{
+    // Static scratch keeps the hot path allocation-free; the overlay is
+    // only drawn from the render thread so there is no reentrancy
+    static float sorted[PROFILER_RING_FRAMES];
+
+    memset(stats, 0, sizeof(*stats));
+    if (ringCount == 0) {
+        return;
+    }
+
+    for (int i = 0; i < ringCount; i++) {
+        sorted[i] = ring[i].frameMs;
+    }
+    qsort(sorted, (size_t)ringCount, sizeof(float), compareFloat);
+
+    stats->frames = ringCount;
+    stats->p50Ms = sorted[ringCount * 50 / 100];
+    stats->p95Ms = sorted[ringCount * 95 / 100];
+    stats->p99Ms = sorted[ringCount * 99 / 100];
+}
+
+void DrawProfilerOverlay(void)
+{
+    if (!overlayVisible) {
+        return;
+    }
+
+    ProfilerStats stats;
+    ProfilerComputeStats(&stats);
+
+    // Per-screen aggregation over the ring. Draw time averages over
+    // drawn frames only, so redraw-skipped frames don't dilute it.
+    double handleSum[PROFILER_NUM_SCREENS] = {0};
+    double drawSum[PROFILER_NUM_SCREENS] = {0};
+    int frames[PROFILER_NUM_SCREENS] = {0};
+    int drawnFrames[PROFILER_NUM_SCREENS] = {0};
+
+    for (int i = 0; i < ringCount; i++) {
+        int s = ring[i].screen;
+        if (s >= PROFILER_NUM_SCREENS) continue;
+        handleSum[s] += ring[i].handleMs;
+        frames[s]++;
+        if (ring[i].drew) {
+            drawSum[s] += ring[i].drawMs;
+            drawnFrames[s]++;
+        }
+    }
+
+    const int fontSize = 18;
+    const int lineStep = fontSize + 4;
+    const int pad = 10;
+    const int panelWidth = 460;
+    char line[128];
+
+    // Panel height: header + column row + one row per screen seen
+    int rows = 0;
+    for (int s = 0; s < PROFILER_NUM_SCREENS; s++) {
+        if (frames[s] > 0) rows++;
+    }
+    int panelHeight = pad * 2 + lineStep * (2 + rows);
+
+    DrawRectangle(0, 0, panelWidth, panelHeight, Fade(BLACK, 0.75f));
+
+    int y = pad;
+    snprintf(line, sizeof(line),
+             "FRAME  p50 %5.1f  p95 %5.1f  p99 %5.1f ms  (%d)",
+             stats.p50Ms, stats.p95Ms, stats.p99Ms, stats.frames);
+    DrawText(line, pad, y, fontSize, LIME);
+    y += lineStep;
+
+    snprintf(line, sizeof(line),
+             "%-14s %8s %8s %7s", "SCREEN", "handle", "draw", "frames");
+    DrawText(line, pad, y, fontSize, GRAY);
+    y += lineStep;
+
+    for (int s = 0; s < PROFILER_NUM_SCREENS; s++) {
+        if (frames[s] == 0) continue;
+        double handleAvg = handleSum[s] / frames[s];
+        double drawAvg = drawnFrames[s] > 0 ? drawSum[s] / drawnFrames[s]
+                                            : 0.0;
+        snprintf(line, sizeof(line), "%-14s %7.2f %8.2f %7d",
+                 SCREEN_NAMES[s], handleAvg, drawAvg, frames[s]);
+        DrawText(line, pad, y, fontSize, RAYWHITE);
+        y += lineStep;
+    }
+}
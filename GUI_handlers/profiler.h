@@ -0,0 +1,83 @@
+/**
+ * @file profiler.h
+ * @brief In-game frame-time profiler overlay
+ *
+ * Lightweight instrumentation for the main loop: every frame's total
+ * time and its handle/draw phase split are captured into a fixed-size
+ * ring buffer, and a debug overlay (toggled with F3) shows p50/p95/p99
+ * frame time plus a per-screen breakdown of the Handle/Draw dispatch.
+ *
+ * Designed to stay compiled into production builds: the capture path is
+ * a handful of GetTime() reads and array stores per frame (no heap, no
+ * locks), and sorting/formatting only happens while the overlay is
+ * visible. Because capture always runs, the overlay already has a full
+ * window of history the moment it is toggled on after a stutter.
+ */
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <stdbool.h>
+
+// Frames kept in the ring buffer (power of two; 4 seconds at 60 FPS)
+#define PROFILER_RING_FRAMES 256
+
+/**
+ * @brief Aggregate frame-time statistics over the ring buffer.
+ */
+typedef struct {
+    int frames;    // Samples currently in the ring
+    float p50Ms;   // Median frame time (milliseconds)
+    float p95Ms;   // 95th percentile frame time
+    float p99Ms;   // 99th percentile frame time
+} ProfilerStats;
+
+/**
+ * @brief Marks the top of the main loop.
+ *
+ * Commits the previous frame's sample (its total time is only known
+ * here), starts timing the new frame's handle phase, and services the
+ * F3 overlay toggle.
+ */
+void ProfilerFrameBegin(void);
+
+/**
+ * @brief Marks the end of the Handle* dispatch for this frame.
+ */
+void ProfilerHandlePhaseEnd(void);
+
+/**
+ * @brief Marks the end of the Draw* dispatch for this frame.
+ *
+ * Call after the draw switch but before the overlay itself renders, so
+ * the overlay's own cost is not attributed to the screen being profiled.
+ * Frames that skip the draw phase simply never call this.
+ */
+void ProfilerDrawPhaseEnd(void);
+
+/**
+ * @brief Whether the overlay is currently shown.
+ *
+ * The main loop's redraw check treats a visible overlay as an animated
+ * element, since its numbers change every frame.
+ */
+bool ProfilerOverlayVisible(void);
+
+/**
+ * @brief Computes percentile statistics over the buffered frames.
+ *
+ * @param stats Output statistics (zeroed when no samples exist)
+ */
+void ProfilerComputeStats(ProfilerStats *stats);
+
+/**
+ * @brief Renders the overlay. No-op while hidden.
+ */
+void DrawProfilerOverlay(void);
+
+/**
+ * @brief Discards all buffered samples and restarts timing.
+ */
+void ProfilerReset(void);
+
+#endif // PROFILER_H
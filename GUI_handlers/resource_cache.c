@@ -0,0 +1,140 @@
+/**
+ * @file resource_cache.c
+ * @brief Background decode, main-thread commit resource registry
+ *
+ * Follows the same one-shot worker pattern as the asynchronous AI
+ * search in game_state.c: a pthread does the slow part into staging
+ * slots it alone writes, sets a done flag, and the render thread joins
+ * and commits when it polls the flag. The split point is dictated by
+ * raylib: LoadWave (file read + OGG decode, the expensive part on eMMC)
+ * is thread-safe, while LoadSoundFromWave touches the audio device and
+ * therefore runs in the main-thread pump.
+ */
+
+#include "resource_cache.h"
+#include "raylib.h"
+#include <pthread.h>
+#include <string.h>
+
+// Every sound the game ships, in GameAudio field order
+enum {
+    SFX_CLICK,
+    SFX_WIN,
+    SFX_LOSE,
+    SFX_DRAW,
+    SFX_COUNT
+};
+
+static const char *SOUND_PATHS[SFX_COUNT] = {
+    "resources/click.ogg",
+    "resources/win.ogg",
+    "resources/lose.ogg",
+    "resources/draw.ogg"
+};
+
+// Staged waves are written only by the loader thread; the registry of
+// playable sounds is written only by the main thread during commit
+static Wave stagedWaves[SFX_COUNT];
+static Sound cachedSounds[SFX_COUNT];
+
+static pthread_t loaderThread;
+static bool loaderRunning = false;         // Thread live, needs a join
+static bool soundsReady = false;           // Registry populated
+static volatile bool loaderDone = false;   // Set by the loader when finished
+
+static void *resourceLoaderWorker(void *arg)
+{
+    (void)arg;
+    for (int i = 0; i < SFX_COUNT; i++) {
+        stagedWaves[i] = LoadWave(SOUND_PATHS[i]);
+    }
+    loaderDone = true;
+    return NULL;
+}
+
+/**
+ * @brief Turns the staged waves into device sounds and frees the waves.
+ *
+ * Main thread only. A wave that failed to load (missing file) leaves a
+ * zeroed Sound in its slot, which PlaySound treats as a silent no-op -
+ * the same behavior LoadSound gave on a missing file before.
+ */
+static void commitStagedWaves(void)
+{
+    for (int i = 0; i < SFX_COUNT; i++) {
+        if (stagedWaves[i].data != NULL) {
+            cachedSounds[i] = LoadSoundFromWave(stagedWaves[i]);
+            UnloadWave(stagedWaves[i]);
+            memset(&stagedWaves[i], 0, sizeof(stagedWaves[i]));
+        }
+    }
+    soundsReady = true;
+    ResourceCacheBindSounds(&game.sfx);
+}
+
+void ResourceCacheBeginLoad(void)
+{
+    if (loaderRunning || soundsReady) {
+        return; // Already loading or already loaded
+    }
+
+    loaderDone = false;
+    if (pthread_create(&loaderThread, NULL, resourceLoaderWorker, NULL) != 0) {
+        // No thread available: decode synchronously so the game still
+        // has its sounds, just without the startup overlap
+        resourceLoaderWorker(NULL);
+        commitStagedWaves();
+        return;
+    }
+    loaderRunning = true;
+}
+
+void ResourceCachePump(void)
+{
+    if (!loaderRunning || !loaderDone) {
+        return; // Nothing in flight, or the decode is still running
+    }
+
+    pthread_join(loaderThread, NULL);
+    loaderRunning = false;
+    commitStagedWaves();
+}
+
+bool ResourceCacheSoundsReady(void)
+{
+    return soundsReady;
+}
+
+void ResourceCacheBindSounds(GameAudio *sfx)
+{
+    sfx->click = cachedSounds[SFX_CLICK];
+    sfx->win = cachedSounds[SFX_WIN];
+    sfx->lose = cachedSounds[SFX_LOSE];
+    sfx->draw = cachedSounds[SFX_DRAW];
+}
+
+void ResourceCacheShutdown(void)
+{
+    // A loader still in flight targets the registry being torn down
+    if (loaderRunning) {
+        pthread_join(loaderThread, NULL);
+        loaderRunning = false;
+    }
+
+    // Waves staged but never committed (shutdown before any pump)
+    for (int i = 0; i < SFX_COUNT; i++) {
+        if (stagedWaves[i].data != NULL) {
+            UnloadWave(stagedWaves[i]);
+            memset(&stagedWaves[i], 0, sizeof(stagedWaves[i]));
+        }
+    }
+
+    if (soundsReady) {
+        for (int i = 0; i < SFX_COUNT; i++) {
+            UnloadSound(cachedSounds[i]);
+            memset(&cachedSounds[i], 0, sizeof(cachedSounds[i]));
+        }
+        soundsReady = false;
+    }
+    loaderDone = false;
+}
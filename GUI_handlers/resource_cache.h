@@ -0,0 +1,70 @@
+/**
+ * @file resource_cache.h
+ * @brief Asynchronous resource loading and sound caching
+ *
+ * Owns every sound the game uses: the OGG files are decoded once, on a
+ * background loader thread, into a registry that outlives individual
+ * games and save restores. InitGame only kicks the loader off, so the
+ * first menu frame renders immediately even on slow kiosk storage;
+ * LoadGame rebinds game.sfx from the registry without touching the
+ * filesystem. Until the loader finishes, the bound handles are zeroed
+ * Sounds, which raylib plays as silent no-ops.
+ *
+ * Decoding (LoadWave) is plain CPU and file work and is safe off the
+ * main thread; creating the playable Sound talks to the audio device,
+ * so that final step is committed on the main thread by the per-frame
+ * pump. The design extends to fonts/textures the same way: stage the
+ * CPU side on the loader, commit the device side in the pump.
+ */
+
+#ifndef RESOURCE_CACHE_H
+#define RESOURCE_CACHE_H
+
+#include <stdbool.h>
+#include "game_state.h"
+
+/**
+ * @brief Starts the background loader thread.
+ *
+ * Returns immediately; call ResourceCachePump each frame to commit the
+ * decoded data once it is ready. If the thread cannot be created, the
+ * sounds are decoded synchronously instead, so the cache always ends up
+ * populated either way.
+ */
+void ResourceCacheBeginLoad(void);
+
+/**
+ * @brief Per-frame poll: commits finished loads on the main thread.
+ *
+ * A few flag checks when there is nothing to do. On the frame the
+ * loader finishes, the staged waves become device Sounds, the registry
+ * is marked ready, and game.sfx is rebound to the cached handles.
+ */
+void ResourceCachePump(void);
+
+/**
+ * @brief Whether the sound registry has been populated.
+ */
+bool ResourceCacheSoundsReady(void);
+
+/**
+ * @brief Points a GameAudio at the cached sound handles.
+ *
+ * Pure handle copies - no disk access, no decoding - so save restores
+ * can rebind without the audible hitch a re-load used to cause. Before
+ * the registry is ready this binds zeroed (silent) handles; the pump
+ * rebinds automatically once loading completes.
+ *
+ * @param sfx Destination sound-effect bundle (normally &game.sfx)
+ */
+void ResourceCacheBindSounds(GameAudio *sfx);
+
+/**
+ * @brief Releases every cached resource and stops the loader.
+ *
+ * Joins a still-running loader first so no thread outlives the cache.
+ * Safe to call when nothing was ever loaded.
+ */
+void ResourceCacheShutdown(void);
+
+#endif // RESOURCE_CACHE_H
@@ -6,8 +6,10 @@
 #include "screens.h"
 #include <stdio.h>
 #include "game_state.h"
+#include "game_record.h"
 #include "ui.h"
 #include "../Game_algorithms/minimax.h"
+#include "../Game_algorithms/minimax_utils.h"
 #include <string.h>
 
 // ============================================================================
@@ -19,58 +21,120 @@
 #define DESIGN_WIDTH 1280.0f
 #define DESIGN_HEIGHT 720.0f
 
+// ============================================================================
+// LAYOUT CACHE
+// ============================================================================
+// OPTIMIZATION: Every Draw* function redoes its full layout math 60 times a
+// second even when nothing on screen changed. The scale factor and centering
+// offsets only change on a window resize, and a measured text width only
+// changes with the string, the font size, or a resize - so both are cached
+// here. An idle menu screen now costs a size check plus hash lookups per
+// frame instead of repeated MeasureText and scaling arithmetic.
+// (A theme change does not invalidate anything: it swaps colors, not fonts.)
+
+static float cachedScale = 1.0f;
+static float cachedHOffset = 0.0f;
+static float cachedVOffset = 0.0f;
+static int cachedScreenWidth = -1;
+static int cachedScreenHeight = -1;
+
+// Direct-mapped cache of measured text widths, keyed by (string, fontSize).
+// A generation counter invalidates every entry at once on resize without
+// having to touch the table.
+#define TEXT_CACHE_SIZE 128
+#define TEXT_CACHE_MAX_LEN 64
+
+typedef struct {
+    char text[TEXT_CACHE_MAX_LEN]; // Copy of the measured string
+    int fontSize;                  // Font size it was measured at
+    int width;                     // Cached MeasureText result
+    unsigned int generation;       // Entry is stale if this lags the counter
+} TextMeasure;
+
+static TextMeasure textCache[TEXT_CACHE_SIZE];
+static unsigned int textCacheGeneration = 1;
+
 /**
- * @brief Calculates how much to scale the UI to fit the current window.
- * @return Scale factor (e.g., 1.0 for 1280x720, 2.0 for 2560x1440)
+ * @brief Recomputes the scale factor and offsets, but only after a resize.
  */
-static float CalculateScaleFactor(void) 
+static void RefreshLayoutCache(void)
 {
-    float scaleX = (float)GetScreenWidth() / DESIGN_WIDTH;
-    float scaleY = (float)GetScreenHeight() / DESIGN_HEIGHT;
+    int width = GetScreenWidth();
+    int height = GetScreenHeight();
+    if (width == cachedScreenWidth && height == cachedScreenHeight) {
+        return; // Fast path: window unchanged, cache is valid
+    }
+
+    cachedScreenWidth = width;
+    cachedScreenHeight = height;
+
+    float scaleX = (float)width / DESIGN_WIDTH;
+    float scaleY = (float)height / DESIGN_HEIGHT;
     // Use smaller scale to maintain aspect ratio (adds black bars if needed)
-    return (scaleX < scaleY) ? scaleX : scaleY;
-}
+    cachedScale = (scaleX < scaleY) ? scaleX : scaleY;
+    cachedHOffset = ((float)width - (DESIGN_WIDTH * cachedScale)) / 2.0f;
+    cachedVOffset = ((float)height - (DESIGN_HEIGHT * cachedScale)) / 2.0f;
 
-/**
- * @brief Calculates horizontal padding to center the game.
- */
-static float CalculateHorizontalOffset(void) 
-{
-    float scale = CalculateScaleFactor();
-    return ((float)GetScreenWidth() - (DESIGN_WIDTH * scale)) / 2.0f;
+    // Font sizes scale with the window, so every measured width is stale
+    textCacheGeneration++;
 }
 
-/**
- * @brief Calculates vertical padding to center the game.
- */
-static float CalculateVerticalOffset(void) 
+int CachedMeasureText(const char* text, int fontSize)
 {
-    float scale = CalculateScaleFactor();
-    return ((float)GetScreenHeight() - (DESIGN_HEIGHT * scale)) / 2.0f;
+    // FNV-1a hash of the string picks the cache slot
+    unsigned int hash = 2166136261u;
+    int length = 0;
+    while (text[length] != '\0' && length < TEXT_CACHE_MAX_LEN - 1) {
+        hash = (hash ^ (unsigned char)text[length]) * 16777619u;
+        length++;
+    }
+    if (text[length] != '\0') {
+        // Too long for an entry (e.g. a history line) - measure directly
+        return MeasureText(text, fontSize);
+    }
+    hash = (hash ^ (unsigned int)fontSize) * 16777619u;
+
+    TextMeasure *entry = &textCache[hash % TEXT_CACHE_SIZE];
+    if (entry->generation == textCacheGeneration &&
+        entry->fontSize == fontSize &&
+        strcmp(entry->text, text) == 0)
+    {
+        return entry->width;
+    }
+
+    // Miss (or collision): measure once and overwrite the slot
+    entry->width = MeasureText(text, fontSize);
+    entry->fontSize = fontSize;
+    entry->generation = textCacheGeneration;
+    memcpy(entry->text, text, length + 1);
+    return entry->width;
 }
 
 /**
  * @brief Converts a design X coordinate (0-1280) to actual screen X coordinate.
  */
-static float ScaleX(float designX) 
+static float ScaleX(float designX)
 {
-    return CalculateHorizontalOffset() + (designX * CalculateScaleFactor());
+    RefreshLayoutCache();
+    return cachedHOffset + (designX * cachedScale);
 }
 
 /**
  * @brief Converts a design Y coordinate (0-720) to actual screen Y coordinate.
  */
-static float ScaleY(float designY) 
+static float ScaleY(float designY)
 {
-    return CalculateVerticalOffset() + (designY * CalculateScaleFactor());
+    RefreshLayoutCache();
+    return cachedVOffset + (designY * cachedScale);
 }
 
 /**
  * @brief Scales a size value (width, height, font size, etc.) to match window size.
  */
-float ScaleSize(float designSize) 
+float ScaleSize(float designSize)
 {
-    return designSize * CalculateScaleFactor();
+    RefreshLayoutCache();
+    return designSize * cachedScale;
 }
 
 // ============================================================================
@@ -81,12 +145,12 @@ void DrawStartScreen(void)
     // Draw Title
     const char* title = "TIC-TAC-TOE";
     int titleSize = ScaleSize(80);
-    int titleWidth = MeasureText(title, titleSize);
+    int titleWidth = CachedMeasureText(title, titleSize);
     DrawText(title, ScaleX(640) - titleWidth/2, ScaleY(100), titleSize, colorPrimary);
     
     const char* subtitle = "Classic Strategy Game";
     int subtitleSize = ScaleSize(25);
-    int subtitleWidth = MeasureText(subtitle, subtitleSize);
+    int subtitleWidth = CachedMeasureText(subtitle, subtitleSize);
     DrawText(subtitle, ScaleX(640) - subtitleWidth/2, ScaleY(190), subtitleSize, colorLight);
     
     // Define button rectangles (using the centering helper)
@@ -109,7 +173,7 @@ void DrawStartScreen(void)
     if (game.saveMessageTimer > 0)
     {
         int msgSize = ScaleSize(20);
-        int textWidth = MeasureText(game.saveMessage, msgSize);
+        int textWidth = CachedMeasureText(game.saveMessage, msgSize);
         DrawText(game.saveMessage, ScaleX(640) - textWidth / 2, ScaleY(565), msgSize, colorAccent);
     }
 
@@ -200,7 +264,7 @@ void DrawModeSelectScreen(void)
 {
     const char* title = "SELECT MODE";
     int titleSize = ScaleSize(60);
-    int titleWidth = MeasureText(title, titleSize);
+    int titleWidth = CachedMeasureText(title, titleSize);
     DrawText(title, ScaleX(640) - titleWidth/2, ScaleY(80), titleSize, colorPrimary);
     
     Rectangle onePlayerButton = CreateButton(ScaleX(640), ScaleY(250), ScaleSize(300), ScaleSize(80));
@@ -247,7 +311,7 @@ void DrawDifficultySelectScreen(void)
 {
     const char* title = "SELECT DIFFICULTY";
     int titleSize = ScaleSize(55);
-    int titleWidth = MeasureText(title, titleSize);
+    int titleWidth = CachedMeasureText(title, titleSize);
     DrawText(title, ScaleX(640) - titleWidth/2, ScaleY(70), titleSize, colorPrimary);
     
     Rectangle easyButton = CreateButton(ScaleX(640), ScaleY(200), ScaleSize(280), ScaleSize(75));
@@ -303,7 +367,7 @@ void DrawSymbolSelectScreen(bool isPlayer1)
 {
     const char* title = isPlayer1 ? "PLAYER 1: CHOOSE SYMBOL" : "CHOOSE YOUR SYMBOL";
     int titleSize = ScaleSize(50);
-    int titleWidth = MeasureText(title, titleSize);
+    int titleWidth = CachedMeasureText(title, titleSize);
     DrawText(title, ScaleX(640) - titleWidth/2, ScaleY(80), titleSize, colorPrimary);
     
     Rectangle xButton = CreateButton(ScaleX(640 - 130), ScaleY(280), ScaleSize(180), ScaleSize(180));
@@ -397,7 +461,7 @@ void DrawInstructionsScreen(void)
     // 2. DRAW TITLE
     const char* title = "INSTRUCTIONS";
     int titleSize = ScaleSize(60);
-    int titleWidth = MeasureText(title, titleSize);
+    int titleWidth = CachedMeasureText(title, titleSize);
     DrawText(title, ScaleX(640) - titleWidth/2, ScaleY(60), titleSize, colorPrimary);
 
     // 3. DRAW LEFT SIDE (Simple Text Explanations)
@@ -494,7 +558,7 @@ void DrawInstructionsScreen(void)
     else if (game.simStep < 6) label = "Example: VERTICAL WIN";
     else label = "Example: DIAGONAL WIN";
     
-    int labelW = MeasureText(label, ScaleSize(20));
+    int labelW = CachedMeasureText(label, ScaleSize(20));
     DrawText(label, simX + simSize/2 - labelW/2, simY + simSize + 20, ScaleSize(20), colorAccent);
 
     // 5. BACK BUTTON
@@ -521,7 +585,7 @@ void DrawGameScreen(void)
     // --- 1. Draw Header & Scores ---
     const char* header = (game.mode == MODE_ONE_PLAYER) ? "YOU vs AI" : "PLAYER 1 vs PLAYER 2";
     int headerSize = ScaleSize(40);
-    int headerWidth = MeasureText(header, headerSize);
+    int headerWidth = CachedMeasureText(header, headerSize);
     DrawText(header, ScaleX(640) - headerWidth/2, ScaleY(30), headerSize, colorPrimary);
     
     char scoreText[64];
@@ -537,7 +601,7 @@ void DrawGameScreen(void)
     }
     
     int scoreSize = ScaleSize(22);
-    int scoreWidth = MeasureText(scoreText, scoreSize);
+    int scoreWidth = CachedMeasureText(scoreText, scoreSize);
     DrawText(scoreText, ScaleX(640) - scoreWidth/2, ScaleY(80), scoreSize, colorLight);
     
     // --- 2. Draw Current Turn Text ---
@@ -563,7 +627,7 @@ void DrawGameScreen(void)
         }
         
         int turnSize = ScaleSize(28);
-        int turnWidth = MeasureText(turnText, turnSize);
+        int turnWidth = CachedMeasureText(turnText, turnSize);
         Color turnColor = game.aiTurn ? colorAccent : colorSecondary;
         DrawText(turnText, ScaleX(640) - turnWidth/2, ScaleY(120), turnSize, turnColor);
     }
@@ -731,7 +795,7 @@ void DrawGameScreen(void)
     if (game.saveMessageTimer > 0)
     {
         int msgSize = ScaleSize(20);
-        int textWidth = MeasureText(game.saveMessage, msgSize);
+        int textWidth = CachedMeasureText(game.saveMessage, msgSize);
         Color msgColor = (strncmp(game.saveMessage, "ERROR", 5) == 0) ? colorAccent : colorSecondary;
         DrawText(game.saveMessage, ScaleX(640) - textWidth / 2, ScaleY(550), msgSize, msgColor);
     }
@@ -799,17 +863,8 @@ void HandleGameScreen(void)
         }
         else if (game.moveCount > 0 && IsButtonHovered(&undoButton))
         {
-            PlaySound(game.sfx.click); 
-            if (game.moveCount > 0)
-            {
-                game.moveCount--;
-                memcpy(game.board, game.moveHistory[game.moveCount].board, sizeof(game.board));
-                game.currentPlayer = game.moveHistory[game.moveCount].currentPlayer;
-                game.aiTurn = game.moveHistory[game.moveCount].aiTurn;
-                game.gameOver = false;
-                game.winner = ' ';
-                game.saveMessageTimer = 0.0f;
-            }
+            PlaySound(game.sfx.click);
+            UndoLastMove(); // Pops the AI reply (if any) with the human move
             return;
         }
         else if (IsButtonHovered(&saveButton))
@@ -847,34 +902,16 @@ void HandleGameScreen(void)
                     
                     if (CheckCollisionPointRec(mousePos, cell) && game.board[i][j] == ' ')
                     {
-                        // Undo Saving (skip only if realloc fails)
-                        bool moveSaved = false;
-                        if (game.moveCount >= game.moveCapacity) {
-                            int newCapacity = (game.moveCapacity == 0) ? 4 : game.moveCapacity * 2;
-                            MoveSnapshot *newHistory = (MoveSnapshot *)realloc(
-                                game.moveHistory,
-                                newCapacity * sizeof(MoveSnapshot)
-                            );
-                            if (newHistory != NULL) {
-                                game.moveHistory = newHistory;
-                                game.moveCapacity = newCapacity;
-                            }
-                        }
-                        if (game.moveCount < game.moveCapacity) {
-                            memcpy(game.moveHistory[game.moveCount].board, game.board, sizeof(game.board));
-                            game.moveHistory[game.moveCount].currentPlayer = game.currentPlayer;
-                            game.moveHistory[game.moveCount].aiTurn = game.aiTurn;
-                            game.moveCount++;
-                            moveSaved = true;
-                        }
-                        (void)moveSaved; // Move proceeds even if undo state wasn't saved
-                        
-                        // Place Symbol & Sound
-                        game.board[i][j] = game.currentPlayer;
+                        // Undo Saving: a 5-byte delta per ply (the
+                        // per-game arena set up by ResetBoard holds all 9)
+                        PushMoveDelta(i, j, game.currentPlayer, false);
+
+                        // Place Symbol & Sound (updates board + masks)
+                        PlaceSymbol(i, j, game.currentPlayer);
                         PlaySound(game.sfx.click);
-                        
-                        // Check Win/Draw
-                        if (CheckWinner(game.board) || IsBoardFull(game.board))
+
+                        // Check Win/Draw (incremental: only lines through (i, j))
+                        if (CheckWinnerAt(i, j) || IsBoardFullMask())
                         {
                             if (!game.gameOver) AppendGameToHistory();
                             game.gameOver = true;
@@ -910,14 +947,32 @@ void HandleGameScreen(void)
     // 5. Handle AI Turn Logic (Runs automatically)
     if (!game.gameOver && game.mode == MODE_ONE_PLAYER && game.aiTurn)
     {
+        // OPTIMIZATION: Kick off the search in the background right away
+        // so it overlaps the cosmetic thinking delay. The delay becomes a
+        // floor on perceived latency, and a search deeper than one frame
+        // budget just keeps the delay running instead of hitching the UI.
+        if (GetAISearchStatus() == AI_SEARCH_IDLE)
+        {
+            SubmitAIMoveSearch();
+        }
+
         game.aiMoveTimer -= GetFrameTime();
-        if (game.aiMoveTimer <= 0)
+        if (game.aiMoveTimer <= 0 && GetAISearchStatus() != AI_SEARCH_RUNNING)
         {
-            MakeAIMove();
-            PlaySound(game.sfx.click); 
-            
+            struct Move aiMove;
+            if (!TakeAIMoveResult(&aiMove))
+            {
+                // Worker could not be started - search synchronously
+                aiMove = MakeAIMove();
+            }
+            else
+            {
+                ApplyAIMove(aiMove);
+            }
+            PlaySound(game.sfx.click);
+
             game.aiTurn = false;
-            if (CheckWinner(game.board) || IsBoardFull(game.board))
+            if ((aiMove.row != -1 && CheckWinnerAt(aiMove.row, aiMove.col)) || IsBoardFullMask())
             {
                 if (!game.gameOver) AppendGameToHistory();
                 game.gameOver = true;
@@ -992,7 +1047,7 @@ void DrawGameOverScreen(void)
     }
     
     int resultSize = ScaleSize(45);
-    int resultWidth = MeasureText(resultText, resultSize);
+    int resultWidth = CachedMeasureText(resultText, resultSize);
     DrawText(resultText, ScaleX(640) - resultWidth/2, panelY + ScaleSize(30), resultSize, resultColor);
     
     // Score display
@@ -1009,7 +1064,7 @@ void DrawGameOverScreen(void)
     }
     
     int scoreSize = ScaleSize(18);
-    int scoreWidth = MeasureText(scoreText, scoreSize);
+    int scoreWidth = CachedMeasureText(scoreText, scoreSize);
     DrawText(scoreText, ScaleX(640) - scoreWidth/2, panelY + ScaleSize(90), scoreSize, colorLight);
     
     // Buttons
@@ -1072,7 +1127,7 @@ void DrawThemeSelectScreen(void)
 {
     const char* title = "SELECT THEME";
     int titleSize = ScaleSize(60);
-    int titleWidth = MeasureText(title, titleSize);
+    int titleWidth = CachedMeasureText(title, titleSize);
     DrawText(title, ScaleX(640) - titleWidth/2, ScaleY(60), titleSize, colorPrimary);
     
     Rectangle defaultButton = CreateButton(ScaleX(640), ScaleY(150), ScaleSize(280), ScaleSize(60));
@@ -1147,7 +1202,7 @@ void DrawHistoryScreen(void)
 {
     const char* title = "GAME HISTORY";
     int titleSize = ScaleSize(60);
-    int titleWidth = MeasureText(title, titleSize);
+    int titleWidth = CachedMeasureText(title, titleSize);
     DrawText(title, ScaleX(640) - titleWidth/2, ScaleY(50), titleSize, colorPrimary);
     
     // Define the History Box
@@ -1163,7 +1218,7 @@ void DrawHistoryScreen(void)
     {
         const char* msg = "No game history found. Go play a game!";
         int msgSize = ScaleSize(24);
-        int msgWidth = MeasureText(msg, msgSize);
+        int msgWidth = CachedMeasureText(msg, msgSize);
         DrawText(msg, ScaleX(640) - msgWidth/2, ScaleY(300), msgSize, colorDark);
     }
     else
@@ -1192,7 +1247,8 @@ void DrawHistoryScreen(void)
             int lineIndex = game.historyScrollOffset + i;
             if (lineIndex >= game.historyLineCount) break;
             
-            DrawText(game.gameHistory[lineIndex], textX, textY + (i * lineHeight), textSize, colorDark);
+            // Lazily paged: only the visible window is ever resident
+            DrawText(GetHistoryLine(lineIndex), textX, textY + (i * lineHeight), textSize, colorDark);
         }
         
         // Draw Scrollbar (Visual Feedback)
@@ -1217,13 +1273,20 @@ void DrawHistoryScreen(void)
         Rectangle clearButton = CreateButton(ScaleX(640 + 245), ScaleY(160), ScaleSize(200), ScaleSize(50));
         DrawButton(&clearButton, "CLEAR", colorAccent);
     }
+
+    if (CountGameRecords() > 0)
+    {
+        Rectangle replayButton = CreateButton(ScaleX(640 + 245), ScaleY(220), ScaleSize(200), ScaleSize(50));
+        DrawButton(&replayButton, "REPLAY", colorPrimary);
+    }
 }
 
 void HandleHistoryScreen(void)
 {
     Rectangle backButton = CreateButton(ScaleX(640), ScaleY(620), ScaleSize(200), ScaleSize(50));
     Rectangle clearButton = CreateButton(ScaleX(640 + 245), ScaleY(160), ScaleSize(200), ScaleSize(50));
-    
+    Rectangle replayButton = CreateButton(ScaleX(640 + 245), ScaleY(220), ScaleSize(200), ScaleSize(50));
+
     // Handle Button Clicks
     if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON))
     {
@@ -1231,7 +1294,7 @@ void HandleHistoryScreen(void)
         {
             PlaySound(game.sfx.click); // <--- SOUND ADDED
             game.screen = SCREEN_START;
-            game.historyScrollOffset = 0; 
+            game.historyScrollOffset = 0;
         }
         else if (game.historyLineCount > 0 && IsButtonHovered(&clearButton))
         {
@@ -1239,6 +1302,15 @@ void HandleHistoryScreen(void)
             ClearGameHistory();
             game.historyScrollOffset = 0;
         }
+        else if (CountGameRecords() > 0 && IsButtonHovered(&replayButton))
+        {
+            PlaySound(game.sfx.click);
+            // Open the replay viewer on the most recent game
+            if (LoadGameReplay(CountGameRecords() - 1))
+            {
+                game.screen = SCREEN_REPLAY;
+            }
+        }
     }
     
     // Handle Mouse Wheel Scrolling
@@ -1247,10 +1319,192 @@ void HandleHistoryScreen(void)
     {
         // Scroll speed: 1 line per wheel click (invert because wheel up is positive)
         game.historyScrollOffset -= (int)wheelMove;
-        
-        // Note: Clamping happens in Draw function to keep logic simple, 
+
+        // Note: Clamping happens in Draw function to keep logic simple,
         // but we can also clamp here for strict correctness.
         if (game.historyScrollOffset < 0) game.historyScrollOffset = 0;
     }
 }
 
+// ============================================================================
+// REPLAY SCREEN
+// ============================================================================
+void DrawReplayScreen(void)
+{
+    // --- 1. Title with the game number ---
+    char title[64];
+    sprintf(title, "REPLAY - GAME %d of %d", game.replayGameIndex + 1, CountGameRecords());
+    int titleSize = ScaleSize(50);
+    int titleWidth = CachedMeasureText(title, titleSize);
+    DrawText(title, ScaleX(640) - titleWidth/2, ScaleY(40), titleSize, colorPrimary);
+
+    // --- 2. Move counter and result ---
+    char statusText[64];
+    if (game.replayStep == 0)
+    {
+        sprintf(statusText, "Start of game (%d moves total)", game.replayTotalPlies);
+    }
+    else
+    {
+        sprintf(statusText, "Move %d of %d", game.replayStep, game.replayTotalPlies);
+    }
+    int statusSize = ScaleSize(28);
+    int statusWidth = CachedMeasureText(statusText, statusSize);
+    DrawText(statusText, ScaleX(640) - statusWidth/2, ScaleY(110), statusSize, colorSecondary);
+
+    if (game.replayStep == game.replayTotalPlies)
+    {
+        char resultText[32];
+        if (game.replayWinner == ' ')
+        {
+            sprintf(resultText, "Result: Draw");
+        }
+        else
+        {
+            sprintf(resultText, "Result: %c wins", game.replayWinner);
+        }
+        int resultSize = ScaleSize(28);
+        int resultWidth = CachedMeasureText(resultText, resultSize);
+        DrawText(resultText, ScaleX(640) - resultWidth/2, ScaleY(145), resultSize, colorAccent);
+    }
+
+    // --- 3. Draw the recorded position (same layout as the game screen) ---
+    float boardSize = ScaleSize(360);
+    float boardX = ScaleX(640) - boardSize/2;
+    float boardY = ScaleY(180);
+    float cellSize = boardSize / 3;
+
+    // Draw grid background
+    DrawRectangleRec(
+        (Rectangle){
+            boardX - ScaleSize(10),
+            boardY - ScaleSize(10),
+            boardSize + ScaleSize(20),
+            boardSize + ScaleSize(20)
+        },
+        colorLight
+    );
+
+    // Draw grid lines
+    for (int i = 1; i < 3; i++)
+    {
+        DrawLineEx(
+            (Vector2){boardX + i * cellSize, boardY},
+            (Vector2){boardX + i * cellSize, boardY + boardSize},
+            ScaleSize(5),
+            colorDark
+        );
+        DrawLineEx(
+            (Vector2){boardX, boardY + i * cellSize},
+            (Vector2){boardX + boardSize, boardY + i * cellSize},
+            ScaleSize(5),
+            colorDark
+        );
+    }
+
+    // Replay the first replayStep deltas onto a scratch board: at most
+    // 9 byte writes, cheaper than storing a board per step ever was
+    char board[3][3];
+    memset(board, ' ', sizeof(board));
+    for (int step = 0; step < game.replayStep; step++)
+    {
+        const MoveDelta *delta = &game.moveHistory[step];
+        board[delta->cell / 3][delta->cell % 3] = delta->symbol;
+    }
+
+    for (int i = 0; i < 3; i++)
+    {
+        for (int j = 0; j < 3; j++)
+        {
+            float x = boardX + j * cellSize + cellSize/2;
+            float y = boardY + i * cellSize + cellSize/2;
+
+            if (board[i][j] == 'X')
+            {
+                float offset = cellSize * 0.25f;
+                DrawLineEx(
+                    (Vector2){x - offset, y - offset},
+                    (Vector2){x + offset, y + offset},
+                    ScaleSize(8),
+                    colorPrimary
+                );
+                DrawLineEx(
+                    (Vector2){x + offset, y - offset},
+                    (Vector2){x - offset, y + offset},
+                    ScaleSize(8),
+                    colorPrimary
+                );
+            }
+            else if (board[i][j] == 'O')
+            {
+                DrawRing(
+                    (Vector2){x, y},
+                    cellSize * 0.25f,
+                    cellSize * 0.3f,
+                    0,
+                    360,
+                    32,
+                    colorAccent
+                );
+            }
+        }
+    }
+
+    // --- 4. Step / navigation buttons ---
+    Rectangle prevMoveButton = CreateButton(ScaleX(640 - 110), ScaleY(590), ScaleSize(200), ScaleSize(50));
+    Rectangle nextMoveButton = CreateButton(ScaleX(640 + 110), ScaleY(590), ScaleSize(200), ScaleSize(50));
+    Rectangle prevGameButton = CreateButton(ScaleX(640 - 330), ScaleY(590), ScaleSize(200), ScaleSize(50));
+    Rectangle nextGameButton = CreateButton(ScaleX(640 + 330), ScaleY(590), ScaleSize(200), ScaleSize(50));
+    Rectangle backButton = CreateButton(ScaleX(640), ScaleY(655), ScaleSize(200), ScaleSize(50));
+
+    DrawButton(&prevMoveButton, "< MOVE", colorPrimary);
+    DrawButton(&nextMoveButton, "MOVE >", colorPrimary);
+    DrawButton(&prevGameButton, "< GAME", colorSecondary);
+    DrawButton(&nextGameButton, "GAME >", colorSecondary);
+    DrawButton(&backButton, "BACK", colorAccent);
+}
+
+void HandleReplayScreen(void)
+{
+    Rectangle prevMoveButton = CreateButton(ScaleX(640 - 110), ScaleY(590), ScaleSize(200), ScaleSize(50));
+    Rectangle nextMoveButton = CreateButton(ScaleX(640 + 110), ScaleY(590), ScaleSize(200), ScaleSize(50));
+    Rectangle prevGameButton = CreateButton(ScaleX(640 - 330), ScaleY(590), ScaleSize(200), ScaleSize(50));
+    Rectangle nextGameButton = CreateButton(ScaleX(640 + 330), ScaleY(590), ScaleSize(200), ScaleSize(50));
+    Rectangle backButton = CreateButton(ScaleX(640), ScaleY(655), ScaleSize(200), ScaleSize(50));
+
+    if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON))
+    {
+        if (IsButtonHovered(&prevMoveButton) && game.replayStep > 0)
+        {
+            PlaySound(game.sfx.click);
+            game.replayStep--;
+        }
+        else if (IsButtonHovered(&nextMoveButton) && game.replayStep < game.replayTotalPlies)
+        {
+            PlaySound(game.sfx.click);
+            game.replayStep++;
+        }
+        else if (IsButtonHovered(&prevGameButton) && game.replayGameIndex > 0)
+        {
+            PlaySound(game.sfx.click);
+            LoadGameReplay(game.replayGameIndex - 1);
+        }
+        else if (IsButtonHovered(&nextGameButton) && game.replayGameIndex < CountGameRecords() - 1)
+        {
+            PlaySound(game.sfx.click);
+            LoadGameReplay(game.replayGameIndex + 1);
+        }
+        else if (IsButtonHovered(&backButton))
+        {
+            PlaySound(game.sfx.click);
+            // The replay borrowed the undo delta array; a fresh game
+            // starts from ResetBoard so no cleanup is needed here
+            game.screen = SCREEN_HISTORY;
+        }
+    }
+
+    // Arrow keys step through moves as well
+    if (IsKeyPressed(KEY_LEFT) && game.replayStep > 0) game.replayStep--;
+    if (IsKeyPressed(KEY_RIGHT) && game.replayStep < game.replayTotalPlies) game.replayStep++;
+}
+
@@ -24,6 +24,19 @@
  */
 float ScaleSize(float designSize);
 
+/**
+ * @brief Measures text width through the layout cache.
+ *
+ * Same result as raylib's MeasureText, but repeated measurements of the
+ * same string at the same size (the per-frame common case) are served
+ * from a cache that is invalidated on window resize.
+ *
+ * @param text String to measure
+ * @param fontSize Font size in actual pixels
+ * @return Text width in pixels
+ */
+int CachedMeasureText(const char* text, int fontSize);
+
 // ============================================================================
 // SCREEN DRAWING FUNCTIONS (The "View")
 // ============================================================================
@@ -74,6 +87,11 @@ void DrawGameOverScreen(void);
  */
 void DrawHistoryScreen(void);
 
+/**
+ * @brief Render the game replay viewer screen
+ */
+void DrawReplayScreen(void);
+
 // ============================================================================
 // SCREEN INPUT HANDLING FUNCTIONS (The "Controller")
 // ============================================================================
@@ -125,4 +143,9 @@ void HandleGameOverScreen(void);
  */
 void HandleHistoryScreen(void);
 
+/**
+ * @brief Process input for the game replay viewer screen
+ */
+void HandleReplayScreen(void);
+
 #endif // SCREENS_H
\ No newline at end of file
@@ -60,7 +60,7 @@ void DrawButton(const Rectangle *button, const char* text, Color color)
     
     // Use responsive font size instead of hardcoded 30
     int fontSize = (int)ScaleSize(30);
-    int textWidth = MeasureText(text, fontSize);
+    int textWidth = CachedMeasureText(text, fontSize);
     DrawText(text, 
              button->x + (button->width - textWidth)/2,
              button->y + (button->height - fontSize)/2,
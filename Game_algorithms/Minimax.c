@@ -9,12 +9,105 @@
 
 #include "minimax.h"
 #include "minimax_utils.h"
+#include "tablebase.h"
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <time.h>
 
-// Global for benchmarking
-int g_max_depth_reached = 0;
+// ============================================================================
+// SEARCH INSTRUMENTATION
+// ============================================================================
+
+/**
+ * Per-search stats collection (see SearchStats in minimax.h). When no
+ * struct is attached every instrumentation site reduces to one pointer
+ * compare, so the uninstrumented search keeps its full speed.
+ */
+static SearchStats *activeStats = NULL;
+
+void minimaxAttachStats(SearchStats *stats) { activeStats = stats; }
+
+// Optional per-node probe (same pattern as the NxN engine): benchmarks
+// hook stack calibration here without the engine linking against them.
+static void (*nodeProbe)(void) = NULL;
+
+void minimaxAttachNodeProbe(void (*probe)(void)) { nodeProbe = probe; }
+
+// ============================================================================
+// RANDOMNESS (EXPLICIT-STATE PRNG)
+// ============================================================================
+
+/**
+ * Error rolls and tie-breaking draw from an Rng (see rng.h) instead of
+ * libc rand(): no hidden global state, no thread serialization, and a
+ * recorded seed replays a game exactly. Entry points without an Rng
+ * parameter share this default generator, self-seeded from the clock.
+ */
+static Rng defaultRng;
+static bool defaultRngSeeded = false;
+
+void minimaxSeedDefaultRng(uint64_t seed) {
+  rngSeed(&defaultRng, seed);
+  defaultRngSeeded = true;
+}
+
+static Rng *getDefaultRng(void) {
+  if (!defaultRngSeeded) {
+    minimaxSeedDefaultRng((uint64_t)time(NULL) ^ ((uint64_t)clock() << 32));
+  }
+  return &defaultRng;
+}
+
+// ============================================================================
+// TRANSPOSITION TABLE (SYMMETRY-CANONICALIZED)
+// ============================================================================
+
+/**
+ * The search revisits positions that are rotations/reflections of ones it
+ * already scored, both within one search and across the 9 top-level probes.
+ * Entries are keyed on the canonical form of (playerMask, oppMask) - see
+ * canonicalizeMasks in minimax_utils.c - so all 8 symmetric variants of a
+ * position share one slot.
+ *
+ * Values are stored depth-relative (as if the node were at depth 0): the
+ * "10 - depth" scoring decays linearly per ply, so a cached value is valid
+ * at any depth after shifting. Because alpha-beta can return bounds rather
+ * than exact scores, each entry carries a flag.
+ */
+#define TT_EMPTY 0
+#define TT_EXACT 1
+#define TT_LOWER 2 // Value is a lower bound (search failed high)
+#define TT_UPPER 3 // Value is an upper bound (search failed low)
+
+typedef struct {
+  signed char value;  // Depth-relative score (-10..10)
+  unsigned char flag; // TT_EMPTY / TT_EXACT / TT_LOWER / TT_UPPER
+} TTEntry;
+
+// One layer per side to move; indexed by (canonPlayer << 9) | canonOpp.
+static TTEntry tt_table[2][1 << 18];
+
+/** @brief Converts a depth-relative cached value to the current depth. */
+static int tt_to_depth(int relValue, int depth) {
+  if (relValue > 0)
+    return relValue - depth;
+  if (relValue < 0)
+    return relValue + depth;
+  return 0;
+}
+
+/** @brief Converts a search result back to its depth-relative form. */
+static int tt_from_depth(int value, int depth) {
+  if (value > 0)
+    return value + depth;
+  if (value < 0)
+    return value - depth;
+  return 0;
+}
+
+void minimaxClearTT(void) { memset(tt_table, 0, sizeof(tt_table)); }
 
 // ============================================================================
 // MINIMAX ALGORITHM (PRIVATE HELPER)
@@ -27,28 +120,62 @@ int g_max_depth_reached = 0;
  */
 static int minimax_masks(int playerMask, int oppMask, int depth, int alpha,
                          int beta, bool isMax) {
-  // Track max depth for benchmarking
-  if (depth > g_max_depth_reached) {
-    g_max_depth_reached = depth;
+  if (activeStats) {
+    activeStats->nodes++;
+    if (depth > activeStats->maxDepth)
+      activeStats->maxDepth = depth;
   }
+  if (nodeProbe)
+    nodeProbe();
 
   // 1. TERMINAL STATE CHECKS
-  if (isWinnerMask(playerMask))
+  if (isWinnerMask(playerMask)) {
+    if (activeStats)
+      activeStats->terminals++;
     return 10 - depth;
-  if (isWinnerMask(oppMask))
+  }
+  if (isWinnerMask(oppMask)) {
+    if (activeStats)
+      activeStats->terminals++;
     return -10 + depth;
-  if ((playerMask | oppMask) == 0x1FF)
+  }
+  if ((playerMask | oppMask) == 0x1FF) {
+    if (activeStats)
+      activeStats->terminals++;
     return 0; // Draw
+  }
+
+  // 2. TRANSPOSITION TABLE PROBE (canonical form covers all 8 symmetries)
+  int canonP, canonO;
+  canonicalizeMasks(playerMask, oppMask, &canonP, &canonO);
+  TTEntry *entry = &tt_table[isMax ? 1 : 0][(canonP << 9) | canonO];
+
+  if (entry->flag != TT_EMPTY) {
+    int val = tt_to_depth(entry->value, depth);
+    if (entry->flag == TT_EXACT ||
+        (entry->flag == TT_LOWER && val >= beta) ||
+        (entry->flag == TT_UPPER && val <= alpha)) {
+      if (activeStats)
+        activeStats->ttHits++;
+      return val;
+    }
+  }
+
+  int alphaOrig = alpha;
+  int betaOrig = beta;
 
-  // 2. RECURSIVE SEARCH
+  // 3. RECURSIVE SEARCH
   int best = isMax ? -1000 : 1000;
 
-  for (int mi = 0; mi < 9; ++mi) {
-    int pos = MOVE_ORDER[mi]; // Optimize order (Center -> Corners -> Edges)
-    int bit = (1 << pos);
+  // Packed legal moves for this occupancy, already in MOVE_ORDER - one
+  // shift per move, no test-and-skip over occupied cells
+  unsigned long long moves = MOVE_LISTS[playerMask | oppMask];
+  int moveCount = (int)(moves & 0xF);
+  moves >>= 4;
 
-    if ((playerMask | oppMask) & bit)
-      continue; // Skip occupied
+  for (int mi = 0; mi < moveCount; ++mi, moves >>= 4) {
+    int pos = (int)(moves & 0xF);
+    int bit = (1 << pos);
 
     if (isMax) {
       int val = minimax_masks(playerMask | bit, oppMask, depth + 1, alpha, beta,
@@ -57,8 +184,11 @@ static int minimax_masks(int playerMask, int oppMask, int depth, int alpha,
         best = val;
       if (val > alpha)
         alpha = val;
-      if (alpha >= beta)
+      if (alpha >= beta) {
+        if (activeStats)
+          activeStats->cutoffs++;
         break; // Beta cutoff
+      }
     } else {
       int val = minimax_masks(playerMask, oppMask | bit, depth + 1, alpha, beta,
                               true);
@@ -66,10 +196,23 @@ static int minimax_masks(int playerMask, int oppMask, int depth, int alpha,
         best = val;
       if (val < beta)
         beta = val;
-      if (alpha >= beta)
+      if (alpha >= beta) {
+        if (activeStats)
+          activeStats->cutoffs++;
         break; // Alpha cutoff
+      }
     }
   }
+
+  // 4. TRANSPOSITION TABLE STORE (flag records whether best is exact)
+  entry->value = (signed char)tt_from_depth(best, depth);
+  if (best <= alphaOrig)
+    entry->flag = TT_UPPER;
+  else if (best >= betaOrig)
+    entry->flag = TT_LOWER;
+  else
+    entry->flag = TT_EXACT;
+
   return best;
 }
 
@@ -79,42 +222,91 @@ static int minimax_masks(int playerMask, int oppMask, int depth, int alpha,
 
 struct Move findBestMoveMinimax(char (*board)[3], char aiSymbol,
                                 int errorRate) {
-  // 1. SETUP: Convert Board to Bitmasks
+  // Convert Board to Bitmasks, then run the mask-based engine
   int maskX = 0, maskO = 0;
   boardToMasks(board, &maskX, &maskO);
 
   int aiMask, oppMask;
   getPlayerMasks(maskX, maskO, aiSymbol, &aiMask, &oppMask);
 
+  return findBestMoveMinimaxMasks(aiMask, oppMask, errorRate);
+}
+
+/** @brief Uninstrumented search body shared by the public entry points. */
+static struct Move searchBestMoveMasks(int aiMask, int oppMask, int errorRate,
+                                       Rng *rng) {
   int occupied = aiMask | oppMask;
   struct Move bestMove = {-1, -1};
 
-  // 2. COLLECT AVAILABLE MOVES
-  int emptyCells[9];
-  int nEmpty = 0;
-  for (int i = 0; i < 9; ++i) {
-    if (!((occupied) & (1 << i))) {
-      emptyCells[nEmpty++] = i;
-    }
-  }
+  // 2. AVAILABLE MOVES: one packed table load replaces the collection loop
+  unsigned long long legalMoves = MOVE_LISTS[occupied];
+  int nEmpty = (int)(legalMoves & 0xF);
+  legalMoves >>= 4;
 
   if (nEmpty == 0)
     return bestMove;
 
+  // ========================================================================
+  // LOGIC: TACTICAL LAYER (Immediate Win)
+  // ========================================================================
+  // Taking a one-move win is always optimal, and detecting one is a few
+  // bitwise ops per line. Checked BEFORE the error roll, so even the
+  // imperfect mode never misses its own winning move.
+  int winPos = findImmediateWin(aiMask, oppMask);
+  if (winPos >= 0) {
+    bestMove.row = winPos / 3;
+    bestMove.col = winPos % 3;
+    return bestMove;
+  }
+
   // ========================================================================
   // LOGIC: FORCED RANDOM MISTAKE (Imperfect Mode)
   // ========================================================================
   if (errorRate > 0) {
-    int roll = rand() % 100; // 0 to 99
+    int roll = rngRange(rng, 100); // 0 to 99
     if (roll < errorRate) {
-      int randomIdx = rand() % nEmpty;
-      int pos = emptyCells[randomIdx];
+      int randomIdx = rngRange(rng, nEmpty);
+      int pos = (int)((legalMoves >> (4 * randomIdx)) & 0xF);
       bestMove.row = pos / 3;
       bestMove.col = pos % 3;
       return bestMove; // Exit Early
     }
   }
 
+  // ========================================================================
+  // LOGIC: TACTICAL LAYER (Forced Block)
+  // ========================================================================
+  // No own win exists (checked above), so if the opponent threatens one,
+  // every non-blocking reply loses on the spot - the block is optimal and
+  // no search is needed. Placed after the error roll: the imperfect mode
+  // is still allowed to blunder a block, just never its own win.
+  int blockPos = findImmediateWin(oppMask, aiMask);
+  if (blockPos >= 0) {
+    bestMove.row = blockPos / 3;
+    bestMove.col = blockPos % 3;
+    return bestMove;
+  }
+
+  // ========================================================================
+  // LOGIC: TABLEBASE LOOKUP (Fast Path)
+  // ========================================================================
+  // If the precomputed tablebase is available, the full candidate list is
+  // a single array load - no recursive search at all. The search below is
+  // kept as the fallback/verification path.
+  int tbCandidates = tablebaseLookup(aiMask, oppMask);
+  if (tbCandidates != 0) {
+    int tbMoves[9];
+    int tbCount = 0;
+    for (int pos = 0; pos < 9; ++pos) {
+      if (tbCandidates & (1 << pos))
+        tbMoves[tbCount++] = pos;
+    }
+    int pos = tbMoves[rngRange(rng, tbCount)];
+    bestMove.row = pos / 3;
+    bestMove.col = pos % 3;
+    return bestMove;
+  }
+
   // ========================================================================
   // LOGIC: PERFECT MINIMAX (With Randomized Ties)
   // ========================================================================
@@ -122,13 +314,12 @@ struct Move findBestMoveMinimax(char (*board)[3], char aiSymbol,
   struct Move bestCandidates[9]; // Array to store equally good moves
   int candidateCount = 0;
 
-  for (int mi = 0; mi < 9; ++mi) {
-    int pos = MOVE_ORDER[mi]; // Use strategic ordering for efficiency
+  // Same packed move list as the recursion: legal moves only, already in
+  // strategic (center -> corners -> edges) order
+  for (int mi = 0; mi < nEmpty; ++mi, legalMoves >>= 4) {
+    int pos = (int)(legalMoves & 0xF);
     int bit = (1 << pos);
 
-    if (occupied & bit)
-      continue;
-
     // Run perfect minimax (depth 1, alpha-beta bounds)
     int moveVal = minimax_masks(aiMask | bit, oppMask, 1, -1000, 1000, false);
 
@@ -150,9 +341,41 @@ struct Move findBestMoveMinimax(char (*board)[3], char aiSymbol,
 
   // 3. PICK A RANDOM MOVE FROM THE BEST CANDIDATES
   if (candidateCount > 0) {
-    int randomIndex = rand() % candidateCount;
+    int randomIndex = rngRange(rng, candidateCount);
     bestMove = bestCandidates[randomIndex];
   }
 
   return bestMove;
 }
+
+struct Move findBestMoveMinimaxMasksRng(int aiMask, int oppMask, int errorRate,
+                                        Rng *rng) {
+  // Fast path: no stats attached, no timing, no zeroing
+  if (activeStats == NULL)
+    return searchBestMoveMasks(aiMask, oppMask, errorRate, rng);
+
+  SearchStats *stats = activeStats;
+  memset(stats, 0, sizeof(*stats));
+
+  clock_t start = clock();
+  struct Move move = searchBestMoveMasks(aiMask, oppMask, errorRate, rng);
+  stats->elapsedMs = 1000.0 * (double)(clock() - start) / CLOCKS_PER_SEC;
+
+  return move;
+}
+
+struct Move findBestMoveMinimaxMasks(int aiMask, int oppMask, int errorRate) {
+  return findBestMoveMinimaxMasksRng(aiMask, oppMask, errorRate,
+                                     getDefaultRng());
+}
+
+struct Move findBestMoveMinimaxRng(char (*board)[3], char aiSymbol,
+                                   int errorRate, Rng *rng) {
+  int maskX = 0, maskO = 0;
+  boardToMasks(board, &maskX, &maskO);
+
+  int aiMask, oppMask;
+  getPlayerMasks(maskX, maskO, aiSymbol, &aiMask, &oppMask);
+
+  return findBestMoveMinimaxMasksRng(aiMask, oppMask, errorRate, rng);
+}
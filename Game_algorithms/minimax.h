@@ -10,6 +10,8 @@
 #ifndef MINIMAX_H
 #define MINIMAX_H
 
+#include "rng.h" // Explicit-state PRNG (error rolls, tie-breaking)
+
 // ============================================================================
 // DATA STRUCTURES
 // ============================================================================
@@ -23,6 +25,23 @@ struct Move {
   int col; /**< Column index (0-2) */
 };
 
+/**
+ * @struct SearchStats
+ * @brief Per-search counters filled in by the minimax engine.
+ *
+ * Attached with minimaxAttachStats; zeroed at the start of every search
+ * so each move's numbers stand alone. Collection costs one pointer
+ * compare per counter when no struct is attached.
+ */
+typedef struct {
+  long nodes;       /**< Search nodes visited (minimax invocations) */
+  long terminals;   /**< Nodes scored directly as win/loss/draw */
+  long ttHits;      /**< Transposition-table probes answered from cache */
+  long cutoffs;     /**< Alpha/beta cutoffs taken */
+  int maxDepth;     /**< Deepest ply reached */
+  double elapsedMs; /**< CPU time of the whole move search, milliseconds */
+} SearchStats;
+
 // ============================================================================
 // AI FUNCTION DECLARATIONS
 // ============================================================================
@@ -41,6 +60,55 @@ struct Move {
  */
 struct Move findBestMoveMinimax(char board[3][3], char aiSymbol, int errorRate);
 
+/**
+ * @brief Mask-based entry point for findBestMoveMinimax.
+ *
+ * Callers that already maintain bitboards (e.g. the GameState masks) can
+ * skip the per-call boardToMasks conversion and pass them directly.
+ * Behaviour is otherwise identical to findBestMoveMinimax.
+ *
+ * @param aiMask Bitmask of the AI's pieces (side to move)
+ * @param oppMask Bitmask of the opponent's pieces
+ * @param errorRate Percentage chance (0-100) to make a random move.
+ * @return Move structure with the best move coordinates
+ */
+struct Move findBestMoveMinimaxMasks(int aiMask, int oppMask, int errorRate);
+
+/**
+ * @brief findBestMoveMinimax drawing randomness from a caller-owned Rng.
+ *
+ * The error roll and the tie-break among equally good moves come from
+ * the supplied generator instead of the engine's default one, so
+ * parallel workers never contend on shared RNG state and a recorded
+ * seed replays the exact same game. The plain entry points remain for
+ * callers that do not care (they use one engine-default Rng).
+ *
+ * @param board 3x3 game board (char array)
+ * @param aiSymbol The symbol the AI is playing ('X' or 'O')
+ * @param errorRate Percentage chance (0-100) to make a random move.
+ * @param rng Seeded generator owned by the caller
+ * @return Move structure with the best move coordinates
+ */
+struct Move findBestMoveMinimaxRng(char board[3][3], char aiSymbol,
+                                   int errorRate, Rng *rng);
+
+/**
+ * @brief Mask-based variant of findBestMoveMinimaxRng.
+ */
+struct Move findBestMoveMinimaxMasksRng(int aiMask, int oppMask, int errorRate,
+                                        Rng *rng);
+
+/**
+ * @brief Seeds the engine-default generator.
+ *
+ * The default Rng backs the entry points without an Rng parameter. It
+ * self-seeds from the clock on first use; call this to make those
+ * paths reproducible (e.g. in tests).
+ *
+ * @param seed Any 64-bit value
+ */
+void minimaxSeedDefaultRng(uint64_t seed);
+
 /**
  * @brief Find the best move using model-based evaluation
  *
@@ -54,7 +122,37 @@ struct Move findBestMoveMinimax(char board[3][3], char aiSymbol, int errorRate);
  */
 struct Move findBestMoveModel(char board[3][3], char aiSymbol);
 
-// Global for benchmarking
-extern int g_max_depth_reached;
+/**
+ * @brief Attaches a stats struct that subsequent searches fill in.
+ *
+ * Every findBestMoveMinimax/findBestMoveMinimaxMasks call zeroes and then
+ * populates the attached struct, so it reflects the most recent search.
+ * Pass NULL to detach; the engine then skips all counting, keeping the
+ * uninstrumented path at full speed. The pointer is engine-global - each
+ * thread of a multithreaded harness must attach its own struct or none.
+ *
+ * @param stats Struct to fill per search, or NULL to disable collection
+ */
+void minimaxAttachStats(SearchStats *stats);
+
+/**
+ * @brief Attaches a probe called once per search node (NULL detaches).
+ *
+ * Same pattern as nxnAttachNodeProbe: benchmarks hook their calibration
+ * here (e.g. a stack-usage sampler) without the engine linking against
+ * them. Probes add a call per node, so leave them detached for timed
+ * runs.
+ */
+void minimaxAttachNodeProbe(void (*probe)(void));
+
+/**
+ * @brief Empties the persistent transposition table.
+ *
+ * The table deliberately survives across searches - warm lookups are the
+ * common case during play. Benchmarks and tests clear it before a
+ * calibration run so the collected stats describe a cold search rather
+ * than whatever the previous run left cached.
+ */
+void minimaxClearTT(void);
 
 #endif // MINIMAX_H
@@ -0,0 +1,470 @@
+/*
+ * minimax_nxn.c
+ * Board-size-parameterized bitboard minimax engine (NxN, k-in-a-row)
+ */
+
+#include "minimax_nxn.h"
+#include "minimax_utils.h" // Zobrist hashing (position keys for the TT)
+#include <stdbool.h>
+#include <stdlib.h>
+
+// ============================================================================
+// ENGINE INITIALIZATION
+// ============================================================================
+
+/**
+ * @brief Adds one winning line mask to the engine tables.
+ */
+static void addWinMask(EngineNxN *engine, uint64_t mask) {
+  if (engine->winMaskCount >= NXN_MAX_LINES)
+    return; // Cannot happen within the supported sizes
+  engine->winMasks[engine->winMaskCount++] = mask;
+
+  for (int cell = 0; cell < engine->cellCount; ++cell) {
+    if (mask & ((uint64_t)1 << cell))
+      engine->cellLineUnion[cell] |= mask;
+  }
+}
+
+/**
+ * @brief Generates every k-in-a-row line for the configured board.
+ *
+ * Walks all start cells and extends in the four line directions
+ * (horizontal, vertical, both diagonals), mirroring how WIN_MASKS in
+ * minimax_utils.c enumerates rows/columns/diagonals for 3x3.
+ */
+static void generateWinMasks(EngineNxN *engine) {
+  const int n = engine->boardSize;
+  const int k = engine->winLength;
+  // Direction deltas: {dRow, dCol}
+  static const int DIRS[4][2] = {{0, 1}, {1, 0}, {1, 1}, {1, -1}};
+
+  engine->winMaskCount = 0;
+  for (int r = 0; r < n; ++r) {
+    for (int c = 0; c < n; ++c) {
+      for (int d = 0; d < 4; ++d) {
+        int endR = r + DIRS[d][0] * (k - 1);
+        int endC = c + DIRS[d][1] * (k - 1);
+        if (endR < 0 || endR >= n || endC < 0 || endC >= n)
+          continue;
+
+        uint64_t mask = 0;
+        for (int i = 0; i < k; ++i) {
+          int cell = (r + DIRS[d][0] * i) * n + (c + DIRS[d][1] * i);
+          mask |= ((uint64_t)1 << cell);
+        }
+        addWinMask(engine, mask);
+      }
+    }
+  }
+}
+
+/**
+ * @brief Orders cells center-outwards (generalizes MOVE_ORDER).
+ *
+ * Alpha-beta prunes more when strong moves come first; central cells
+ * intersect the most winning lines, so they are searched first.
+ */
+static void generateMoveOrder(EngineNxN *engine) {
+  const int n = engine->boardSize;
+  int distance[NXN_MAX_CELLS];
+
+  for (int cell = 0; cell < engine->cellCount; ++cell) {
+    int r = cell / n, c = cell % n;
+    // Squared distance from board center, doubled to stay integral
+    int dr = 2 * r - (n - 1);
+    int dc = 2 * c - (n - 1);
+    distance[cell] = dr * dr + dc * dc;
+    engine->moveOrder[cell] = cell;
+  }
+
+  // Insertion sort by centrality (cellCount <= 64, runs once at init)
+  for (int i = 1; i < engine->cellCount; ++i) {
+    int cell = engine->moveOrder[i];
+    int j = i - 1;
+    while (j >= 0 && distance[engine->moveOrder[j]] > distance[cell]) {
+      engine->moveOrder[j + 1] = engine->moveOrder[j];
+      --j;
+    }
+    engine->moveOrder[j + 1] = cell;
+  }
+}
+
+bool initEngineNxN(EngineNxN *engine, int boardSize, int winLength) {
+  if (engine == NULL)
+    return false;
+  if (boardSize < 3 || boardSize > NXN_MAX_SIZE)
+    return false;
+  if (winLength < 2 || winLength > boardSize)
+    return false;
+
+  engine->boardSize = boardSize;
+  engine->winLength = winLength;
+  engine->cellCount = boardSize * boardSize;
+  engine->fullMask = (engine->cellCount == 64)
+                         ? ~(uint64_t)0
+                         : (((uint64_t)1 << engine->cellCount) - 1);
+
+  for (int cell = 0; cell < engine->cellCount; ++cell)
+    engine->cellLineUnion[cell] = 0;
+
+  generateWinMasks(engine);
+  generateMoveOrder(engine);
+  return true;
+}
+
+// ============================================================================
+// WIN CHECK & EVALUATION
+// ============================================================================
+
+bool isWinnerMaskNxN(const EngineNxN *engine, uint64_t mask) {
+  for (int i = 0; i < engine->winMaskCount; ++i) {
+    if ((mask & engine->winMasks[i]) == engine->winMasks[i])
+      return true;
+  }
+  return false;
+}
+
+/**
+ * @brief Counts set bits in a 64-bit mask (64-bit countBits).
+ */
+static int countBits64(uint64_t mask) {
+  int count = 0;
+  while (mask) {
+    mask &= mask - 1; // Clear lowest set bit
+    ++count;
+  }
+  return count;
+}
+
+int evaluateNxN(const EngineNxN *engine, uint64_t aiMask, uint64_t oppMask) {
+  int score = 0;
+  for (int i = 0; i < engine->winMaskCount; ++i) {
+    uint64_t line = engine->winMasks[i];
+    uint64_t aiStones = aiMask & line;
+    uint64_t oppStones = oppMask & line;
+
+    // A line only matters while exactly one side can still complete it
+    if (aiStones && !oppStones) {
+      int n = countBits64(aiStones);
+      score += n * n;
+    } else if (oppStones && !aiStones) {
+      int n = countBits64(oppStones);
+      score -= n * n;
+    }
+  }
+  return score;
+}
+
+// ============================================================================
+// DEPTH-LIMITED ALPHA-BETA SEARCH
+// ============================================================================
+
+// Win scores sit far above any heuristic value so the search always
+// prefers a forced win (and the fastest one, via the depth penalty).
+#define NXN_WIN_SCORE 1000000
+
+// ============================================================================
+// TRANSPOSITION TABLE (ZOBRIST-KEYED)
+// ============================================================================
+
+/**
+ * NxN masks are too wide to index a table the way the 3x3 engine's
+ * (playerMask << 9) | oppMask scheme does, so entries are keyed by the
+ * Zobrist hash carried through the search (one XOR per make/unmake, see
+ * minimax_utils.h). The table is direct-mapped on the low hash bits with
+ * the full hash stored for verification; a mismatch is simply a miss and
+ * the entry is overwritten (replace-always), keeping every probe one
+ * cache line.
+ *
+ * Heuristic values are only valid for the draft (plies of search below
+ * the node) they were computed with, so entries record it and hits
+ * require an exact draft match. Win scores carry a depth penalty and are
+ * stored depth-relative, mirroring the 3x3 table.
+ */
+#define NXN_TT_EMPTY 0
+#define NXN_TT_EXACT 1
+#define NXN_TT_LOWER 2 // Value is a lower bound (search failed high)
+#define NXN_TT_UPPER 3 // Value is an upper bound (search failed low)
+
+#define NXN_TT_BITS 18 // 262,144 entries (4 MB)
+
+typedef struct {
+  uint64_t key;       // Full hash, verified on probe
+  int32_t value;      // Depth-relative score
+  int8_t draft;       // maxDepth - depth the value was computed with
+  uint8_t flag;       // NXN_TT_EMPTY / EXACT / LOWER / UPPER
+} NxNTTEntry;
+
+static NxNTTEntry nxn_tt[1 << NXN_TT_BITS];
+
+/** @brief Converts a depth-relative cached value to the current depth. */
+static int nxn_tt_to_depth(int relValue, int depth) {
+  if (relValue > NXN_WIN_SCORE / 2)
+    return relValue - depth;
+  if (relValue < -NXN_WIN_SCORE / 2)
+    return relValue + depth;
+  return relValue; // Heuristic values carry no depth penalty
+}
+
+/** @brief Converts a search result back to its depth-relative form. */
+static int nxn_tt_from_depth(int value, int depth) {
+  if (value > NXN_WIN_SCORE / 2)
+    return value + depth;
+  if (value < -NXN_WIN_SCORE / 2)
+    return value - depth;
+  return value;
+}
+
+// ============================================================================
+// ITERATIVE SEARCH (EXPLICIT FRAME STACK)
+// ============================================================================
+
+/**
+ * The search runs as a loop over an explicit frame stack instead of
+ * recursing. Deep NxN searches were the one place the engine's memory
+ * use grew with depth - each recursive call burned a full C stack frame
+ * (saved registers, spilled locals, return address), which the
+ * benchmark suite's StackTracker exists to measure and which the
+ * embedded port cannot afford at 30+ plies. A frame here holds exactly
+ * the state alpha-beta needs (24 bytes of masks/hash plus the window
+ * and move cursor), the whole stack is a static array sized by the
+ * worst case (one frame per cell), and descending a ply is a struct
+ * store rather than a function call.
+ *
+ * Like the transposition table above, the stack makes the search
+ * non-reentrant; the engine was already used that way. Because the
+ * entire search state lives in this array, a search could be suspended
+ * after any iteration and resumed later - the hook the asynchronous AI
+ * work needs.
+ */
+typedef struct {
+  uint64_t playerMask; // Position the frame is searching
+  uint64_t oppMask;
+  uint64_t hash;       // Zobrist key for the position
+  int alpha, beta;     // Current window (narrows as children return)
+  int alphaOrig;       // Window at entry, for the TT store flag
+  int betaOrig;
+  int best;            // Best value seen so far
+  int mi;              // Next index into engine->moveOrder
+  bool isMax;
+} NxNSearchFrame;
+
+static NxNSearchFrame nxn_stack[NXN_SEARCH_MAX_FRAMES];
+static int nxn_peak_frames = 0;
+static void (*nxn_node_probe)(void) = NULL;
+
+int nxnSearchPeakFrames(void) { return nxn_peak_frames; }
+
+size_t nxnSearchStackBytes(void) { return sizeof(nxn_stack); }
+
+void nxnAttachNodeProbe(void (*probe)(void)) { nxn_node_probe = probe; }
+
+/**
+ * @brief Resolves a node that needs no expansion (terminal, depth
+ * limit, or transposition-table hit).
+ *
+ * @param value Output: the node's value when resolved
+ * @return true if the node resolved, false if it must be expanded
+ */
+static bool nxn_resolve_leaf(const EngineNxN *engine, uint64_t playerMask,
+                             uint64_t oppMask, uint64_t hash, int depth,
+                             int maxDepth, int alpha, int beta, int *value) {
+  // 1. TERMINAL STATE CHECKS
+  if (isWinnerMaskNxN(engine, playerMask)) {
+    *value = NXN_WIN_SCORE - depth;
+    return true;
+  }
+  if (isWinnerMaskNxN(engine, oppMask)) {
+    *value = -NXN_WIN_SCORE + depth;
+    return true;
+  }
+  if ((playerMask | oppMask) == engine->fullMask) {
+    *value = 0; // Draw
+    return true;
+  }
+
+  // 2. DEPTH LIMIT: fall back to the heuristic evaluation
+  if (depth >= maxDepth) {
+    *value = evaluateNxN(engine, playerMask, oppMask);
+    return true;
+  }
+
+  // 3. TRANSPOSITION TABLE PROBE
+  int draft = maxDepth - depth;
+  NxNTTEntry *entry = &nxn_tt[hash & ((1 << NXN_TT_BITS) - 1)];
+
+  if (entry->flag != NXN_TT_EMPTY && entry->key == hash &&
+      entry->draft == draft) {
+    int val = nxn_tt_to_depth(entry->value, depth);
+    if (entry->flag == NXN_TT_EXACT ||
+        (entry->flag == NXN_TT_LOWER && val >= beta) ||
+        (entry->flag == NXN_TT_UPPER && val <= alpha)) {
+      *value = val;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+/**
+ * @brief Pushes a fresh frame for a position onto the explicit stack.
+ */
+static void nxn_push_frame(int sp, uint64_t playerMask, uint64_t oppMask,
+                           uint64_t hash, int alpha, int beta, bool isMax) {
+  NxNSearchFrame *f = &nxn_stack[sp];
+  f->playerMask = playerMask;
+  f->oppMask = oppMask;
+  f->hash = hash;
+  f->alpha = alpha;
+  f->beta = beta;
+  f->alphaOrig = alpha;
+  f->betaOrig = beta;
+  f->best = isMax ? -2 * NXN_WIN_SCORE : 2 * NXN_WIN_SCORE;
+  f->mi = 0;
+  f->isMax = isMax;
+
+  if (sp + 1 > nxn_peak_frames)
+    nxn_peak_frames = sp + 1;
+  if (nxn_node_probe != NULL)
+    nxn_node_probe();
+}
+
+/**
+ * @brief Iterative alpha-beta over the explicit frame stack.
+ *
+ * Same value as the old recursive minimax_nxn for any position: the
+ * checks run in the same order (terminals, depth limit, TT probe,
+ * center-first expansion) and the TT is read and written at the same
+ * points - only the call stack became an array.
+ */
+static int minimax_nxn(const EngineNxN *engine, uint64_t playerMask,
+                       uint64_t oppMask, uint64_t hash, int depth,
+                       int maxDepth, int alpha, int beta, bool isMax) {
+  int retVal;
+  if (nxn_resolve_leaf(engine, playerMask, oppMask, hash, depth, maxDepth,
+                       alpha, beta, &retVal))
+    return retVal;
+
+  const int depth0 = depth; // Depth of nxn_stack[0]
+  nxn_push_frame(0, playerMask, oppMask, hash, alpha, beta, isMax);
+  int sp = 1;
+  bool haveRet = false; // retVal carries a child value to apply
+
+  while (sp > 0) {
+    NxNSearchFrame *f = &nxn_stack[sp - 1];
+    int fDepth = depth0 + sp - 1;
+
+    // A child just returned: fold its value into this frame's window
+    if (haveRet) {
+      haveRet = false;
+      if (f->isMax) {
+        if (retVal > f->best)
+          f->best = retVal;
+        if (retVal > f->alpha)
+          f->alpha = retVal;
+      } else {
+        if (retVal < f->best)
+          f->best = retVal;
+        if (retVal < f->beta)
+          f->beta = retVal;
+      }
+    }
+
+    // 4. EXPANSION (center-first ordering), unless the window closed
+    int pos = -1;
+    if (f->alpha < f->beta) {
+      uint64_t occupied = f->playerMask | f->oppMask;
+      while (f->mi < engine->cellCount) {
+        int p = engine->moveOrder[f->mi++];
+        if (!(occupied & ((uint64_t)1 << p))) {
+          pos = p;
+          break;
+        }
+      }
+    }
+
+    if (pos < 0) {
+      // Cutoff or moves exhausted: the frame's value is final
+      // 5. TRANSPOSITION TABLE STORE (replace-always)
+      NxNTTEntry *entry = &nxn_tt[f->hash & ((1 << NXN_TT_BITS) - 1)];
+      entry->key = f->hash;
+      entry->value = (int32_t)nxn_tt_from_depth(f->best, fDepth);
+      entry->draft = (int8_t)(maxDepth - fDepth);
+      if (f->best <= f->alphaOrig)
+        entry->flag = NXN_TT_UPPER;
+      else if (f->best >= f->betaOrig)
+        entry->flag = NXN_TT_LOWER;
+      else
+        entry->flag = NXN_TT_EXACT;
+
+      retVal = f->best;
+      haveRet = true;
+      --sp;
+      continue;
+    }
+
+    // Descend: child hash is one XOR for the stone, one for the turn
+    uint64_t bit = ((uint64_t)1 << pos);
+    uint64_t childPlayer = f->playerMask;
+    uint64_t childOpp = f->oppMask;
+    uint64_t childHash;
+    if (f->isMax) {
+      childPlayer |= bit;
+      childHash = f->hash ^ ZOBRIST_KEYS[0][pos] ^ ZOBRIST_SIDE_KEY;
+    } else {
+      childOpp |= bit;
+      childHash = f->hash ^ ZOBRIST_KEYS[1][pos] ^ ZOBRIST_SIDE_KEY;
+    }
+
+    if (nxn_resolve_leaf(engine, childPlayer, childOpp, childHash, fDepth + 1,
+                         maxDepth, f->alpha, f->beta, &retVal)) {
+      haveRet = true; // Leaf value folds in on the next iteration
+      continue;
+    }
+
+    nxn_push_frame(sp, childPlayer, childOpp, childHash, f->alpha, f->beta,
+                   !f->isMax);
+    ++sp;
+  }
+
+  return retVal;
+}
+
+// ============================================================================
+// PUBLIC API FUNCTION
+// ============================================================================
+
+struct Move findBestMoveMinimaxNxN(const EngineNxN *engine, uint64_t aiMask,
+                                   uint64_t oppMask, int maxDepth) {
+  struct Move bestMove = {-1, -1};
+  if (engine == NULL || maxDepth < 1)
+    return bestMove;
+
+  uint64_t occupied = aiMask | oppMask;
+  int bestVal = -2 * NXN_WIN_SCORE;
+  nxn_peak_frames = 0; // High-water mark covers the whole move loop
+
+  // Hash the root once; the recursion maintains it incrementally
+  uint64_t rootHash = zobristHashMasks64(aiMask, oppMask);
+
+  for (int mi = 0; mi < engine->cellCount; ++mi) {
+    int pos = engine->moveOrder[mi];
+    uint64_t bit = ((uint64_t)1 << pos);
+    if (occupied & bit)
+      continue;
+
+    uint64_t childHash = rootHash ^ ZOBRIST_KEYS[0][pos] ^ ZOBRIST_SIDE_KEY;
+    int moveVal = minimax_nxn(engine, aiMask | bit, oppMask, childHash, 1,
+                              maxDepth, -2 * NXN_WIN_SCORE, 2 * NXN_WIN_SCORE,
+                              false);
+    if (moveVal > bestVal) {
+      bestVal = moveVal;
+      bestMove.row = pos / engine->boardSize;
+      bestMove.col = pos % engine->boardSize;
+    }
+  }
+
+  return bestMove;
+}
@@ -0,0 +1,121 @@
+/**
+ * @file minimax_nxn.h
+ * @brief Board-size-parameterized bitboard minimax engine
+ *
+ * Generalizes the 3x3 bitboard approach from minimax_utils.c to NxN
+ * boards with k-in-a-row win conditions (4x4, 5x5 variants). Boards are
+ * 64-bit masks (cell (r, c) = bit r * boardSize + c), win-mask tables and
+ * move orderings are generated per size at engine init, and the win check
+ * stays a plain bitwise AND against precomputed line masks.
+ *
+ * Larger boards cannot be searched to the end, so the search here is
+ * depth-limited with a heuristic evaluation based on open lines. The
+ * classic 3x3 game keeps using the exact engine in Minimax.c.
+ */
+
+#ifndef MINIMAX_NXN_H
+#define MINIMAX_NXN_H
+
+#include "minimax.h" // For struct Move
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Engine limits: boards up to 8x8 fit in a 64-bit mask
+#define NXN_MAX_SIZE 8
+#define NXN_MAX_CELLS (NXN_MAX_SIZE * NXN_MAX_SIZE)
+#define NXN_MAX_LINES 512
+
+/**
+ * @struct EngineNxN
+ * @brief Per-board-size engine state (win masks, move order, full mask)
+ *
+ * Built once by initEngineNxN and then treated as read-only, so one
+ * engine can be shared by concurrent searches.
+ */
+typedef struct {
+  int boardSize;  /**< Board is boardSize x boardSize (3-8) */
+  int winLength;  /**< Stones in a row needed to win (k) */
+  int cellCount;  /**< boardSize * boardSize */
+  uint64_t fullMask; /**< All cells occupied */
+
+  /** Precomputed winning line masks, generated at init */
+  uint64_t winMasks[NXN_MAX_LINES];
+  int winMaskCount;
+
+  /** Cells ordered center-outwards (generalizes MOVE_ORDER) */
+  int moveOrder[NXN_MAX_CELLS];
+
+  /** For each cell, the winning lines passing through it (heuristic aid) */
+  uint64_t cellLineUnion[NXN_MAX_CELLS];
+} EngineNxN;
+
+/**
+ * @brief Initializes an engine for a given board size and win length.
+ *
+ * Generates the win-mask table and center-first move ordering.
+ *
+ * @param engine Engine to initialize
+ * @param boardSize Board side length (3-8)
+ * @param winLength Stones in a row to win (2..boardSize)
+ * @return true on success, false for unsupported parameters
+ */
+bool initEngineNxN(EngineNxN *engine, int boardSize, int winLength);
+
+/**
+ * @brief Returns true if the mask contains any winning line.
+ */
+bool isWinnerMaskNxN(const EngineNxN *engine, uint64_t mask);
+
+/**
+ * @brief Heuristic evaluation of a position (positive favors aiMask).
+ *
+ * Scores every line that is still winnable for exactly one side,
+ * weighting lines quadratically by how many stones they already hold.
+ */
+int evaluateNxN(const EngineNxN *engine, uint64_t aiMask, uint64_t oppMask);
+
+/**
+ * @brief Finds the best move using depth-limited alpha-beta search.
+ *
+ * With maxDepth >= the number of empty cells this is an exact search
+ * (equivalent to the unlimited 3x3 engine); for larger boards a depth
+ * of 6-8 gives strong play at interactive speed.
+ *
+ * @param engine Initialized engine describing the board variant
+ * @param aiMask Bitmask of the side to move
+ * @param oppMask Bitmask of the opponent
+ * @param maxDepth Ply limit before falling back to evaluateNxN
+ * @return Best move found, or {-1, -1} if the board is full
+ */
+struct Move findBestMoveMinimaxNxN(const EngineNxN *engine, uint64_t aiMask,
+                                   uint64_t oppMask, int maxDepth);
+
+// The explicit search stack holds at most one frame per ply; a board can
+// never see more plies than it has cells, so the footprint is fixed at
+// compile time regardless of maxDepth.
+#define NXN_SEARCH_MAX_FRAMES (NXN_MAX_CELLS + 1)
+
+/**
+ * @brief Peak explicit-stack frames used by the most recent search.
+ *
+ * Verifies the compile-time bound: always <= NXN_SEARCH_MAX_FRAMES, and
+ * in practice bounded by min(maxDepth, empty cells).
+ */
+int nxnSearchPeakFrames(void);
+
+/**
+ * @brief Size in bytes of the engine's whole explicit frame stack.
+ */
+size_t nxnSearchStackBytes(void);
+
+/**
+ * @brief Attaches a probe called once per expanded node (NULL detaches).
+ *
+ * Same pattern as minimaxAttachStats: benchmarks hook their calibration
+ * here (e.g. the StackTracker) without the engine linking against them.
+ * Probes add a call per node, so leave them detached for timed runs.
+ */
+void nxnAttachNodeProbe(void (*probe)(void));
+
+#endif // MINIMAX_NXN_H
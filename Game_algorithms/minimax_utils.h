@@ -7,6 +7,7 @@
 #define MINIMAX_UTILS_H
 
 #include <stdbool.h>
+#include <stdint.h>
 
 // Precomputed win masks (8 possible lines)
 extern const int WIN_MASKS[8];
@@ -14,18 +15,60 @@ extern const int WIN_MASKS[8];
 // Preferred move ordering (center, corners, edges)
 extern const int MOVE_ORDER[9];
 
+/**
+ * @brief Packed legal-move lists, indexed by the 9-bit occupancy mask.
+ *
+ * MOVE_LISTS[maskX | maskO] holds every empty cell of that occupancy in
+ * MOVE_ORDER (center, corners, edges), 4 bits per move, with the move
+ * count in the low 4 bits:
+ *
+ *   bits 0-3:  number of legal moves (9 - popcount(occupancy))
+ *   bits 4-7:  first move's cell index, bits 8-11 the second, ...
+ *
+ * Search loops walk it with one shift per move instead of iterating all
+ * 9 positions and test-and-skipping occupied bits. The table is built at
+ * compile time (see the ML_* macros in minimax_utils.c), so it needs no
+ * initialization call.
+ */
+extern const unsigned long long MOVE_LISTS[512];
+
 // Convert 3x3 char board to two bitmasks (maskX, maskO)
 void boardToMasks(const char board[3][3], int *maskX, int *maskO);
 
 // Return true if mask contains any winning line
 bool isWinnerMask(int mask);
 
+/**
+ * @brief Win check restricted to the lines through one cell.
+ *
+ * Equivalent to isWinnerMask when the last move landed on pos, but only
+ * tests the 2-4 lines that pass through that cell.
+ *
+ * @param mask Bitmask of the player who just moved
+ * @param pos Cell index (0-8) of that player's last move
+ * @return true if the move completed a winning line
+ */
+bool isWinnerMaskAt(int mask, int pos);
+
 // Count number of set bits in mask
 int countBits(int mask);
 
+/**
+ * @brief Finds a cell that wins the game for playerMask in one move.
+ *
+ * Scans WIN_MASKS for a line where the player holds two cells and the
+ * opponent none; the third cell of that line completes it. Call with
+ * the masks swapped to find the cell a threatened player must block.
+ *
+ * @param playerMask Bitmask of the player who would move
+ * @param oppMask Bitmask of their opponent
+ * @return Winning cell index (0-8), or -1 if no one-move win exists
+ */
+int findImmediateWin(int playerMask, int oppMask);
+
 /**
  * @brief Determines the AI and Opponent bitmasks based on the current board state.
- * 
+ *
  * @param maskX Bitmask of X pieces
  * @param maskO Bitmask of O pieces
  * @param aiSymbol The symbol the AI is playing ('X' or 'O')
@@ -34,4 +77,83 @@ int countBits(int mask);
  */
 void getPlayerMasks(int maskX, int maskO, char aiSymbol, int *aiMask, int *oppMask);
 
+// Number of board symmetries (4 rotations x optional mirror)
+#define NUM_SYMMETRIES 8
+
+/**
+ * @brief Applies one of the 8 board symmetries to a bitmask.
+ *
+ * @param mask Bitmask to transform (bits 0-8, layout documented in minimax_utils.c)
+ * @param symmetry Symmetry index (0 = identity, 1-3 = rotations, 4-7 = mirrored)
+ * @return Transformed bitmask
+ */
+int transformMask(int mask, int symmetry);
+
+/**
+ * @brief Reduces a position to its canonical form under the 8 symmetries.
+ *
+ * Rotations/reflections of the same position all map to one representative,
+ * so caches keyed on the canonical masks hit for every symmetric variant.
+ *
+ * @param playerMask Bitmask of the side to move
+ * @param oppMask Bitmask of the opponent
+ * @param canonPlayer Pointer to store the canonical player bitmask
+ * @param canonOpp Pointer to store the canonical opponent bitmask
+ */
+void canonicalizeMasks(int playerMask, int oppMask, int *canonPlayer, int *canonOpp);
+
+// ============================================================================
+// ZOBRIST HASHING
+// ============================================================================
+// Standard way for any caller to derive a position identity. The 3x3
+// engine can index caches by raw mask pairs (18 bits), but anything
+// larger needs a hash - and a Zobrist hash is maintained incrementally:
+// making or unmaking a move is one XOR with that cell's key, plus one
+// XOR with ZOBRIST_SIDE_KEY to flip whose turn it is, instead of
+// recomputing from the masks at every node.
+
+// Large enough for the NxN engine's 8x8 ceiling (NXN_MAX_CELLS)
+#define ZOBRIST_MAX_CELLS 64
+
+/**
+ * @brief Per-cell/per-side random keys: ZOBRIST_KEYS[side][cell].
+ *
+ * Side 0 is the player whose mask is passed first to the hash helpers
+ * (by convention the side to move at the root of a search); side 1 is
+ * the opponent. Generated once by initZobristKeys from a fixed seed, so
+ * hashes are reproducible across runs and builds.
+ */
+extern uint64_t ZOBRIST_KEYS[2][ZOBRIST_MAX_CELLS];
+
+/** @brief XORed into the hash whenever the side to move flips. */
+extern uint64_t ZOBRIST_SIDE_KEY;
+
+/**
+ * @brief Fills the Zobrist key tables (idempotent, call before use).
+ *
+ * The full-hash helpers below call it lazily; code that XORs the key
+ * arrays directly for incremental updates must call it once first.
+ */
+void initZobristKeys(void);
+
+/**
+ * @brief Full hash of a 3x3 position from its 9-bit masks.
+ *
+ * Use once at the root of a search, then maintain the hash with
+ * incremental XORs as moves are made and unmade.
+ *
+ * @param playerMask Bitmask of the side to move (hashed with side 0 keys)
+ * @param oppMask Bitmask of the opponent (hashed with side 1 keys)
+ * @return 64-bit position hash
+ */
+uint64_t zobristHashMasks(int playerMask, int oppMask);
+
+/**
+ * @brief Full hash of an NxN position from its 64-bit masks.
+ *
+ * Same convention as zobristHashMasks, for boards up to 8x8
+ * (cell = row * boardSize + col, as in minimax_nxn.c).
+ */
+uint64_t zobristHashMasks64(uint64_t playerMask, uint64_t oppMask);
+
 #endif // MINIMAX_UTILS_H
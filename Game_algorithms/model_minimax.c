@@ -11,6 +11,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <limits.h>
+#include <stdint.h>
 #include "model_minimax.h"
 #include "minimax.h"
 
@@ -19,9 +20,13 @@
 // ============================================================================
 
 /**
- * @brief Pre-trained logistic regression weights for each board position (3x3).
+ * @brief Logistic regression weights for each board position (3x3).
+ *
+ * These compiled-in values are the shipped defaults; loadModelParams()
+ * overwrites them at startup when logistic_regression_params.json is
+ * present, so retraining no longer requires a rebuild.
  */
-const double LR_WEIGHTS[9] = {
+double LR_WEIGHTS[9] = {
     3.928391392624212,     // [0][0]
     3.6032407817955696,    // [0][1]
     4.011058129716569,     // [0][2]
@@ -34,9 +39,148 @@ const double LR_WEIGHTS[9] = {
 };
 
 /**
- * @brief Pre-trained logistic regression bias term.
+ * @brief Logistic regression bias term (same default/override scheme).
  */
-const double LR_BIAS = -1.6450287057758302;
+double LR_BIAS = -1.6450287057758302;
+
+// ============================================================================
+// QUANTIZED PARAMETERS (Q16.16 FIXED POINT)
+// ============================================================================
+
+/**
+ * @brief Q16.16 copies of the model parameters for integer inference.
+ *
+ * OPTIMIZATION: move selection only needs the argmax of the dot product,
+ * not its exact value, and the features are all in {-1, 0, 1}. Scaling
+ * the weights by 2^16 and rounding once at load time turns every
+ * per-move evaluation into integer adds - no FPU use at all on the hot
+ * path, which matters for embedded targets and bulk simulation runs.
+ * 2^16 keeps the worst-case accumulation (bias + 9 weights, each |w| well
+ * under 2^14) comfortably inside int32_t while preserving far more
+ * resolution than the gaps between trained weights.
+ */
+static int32_t LR_WEIGHTS_Q[9];
+static int32_t LR_BIAS_Q;
+static bool quantParamsReady = false;
+
+/** @brief Rounds one double parameter to Q16.16. */
+static int32_t quantizeParam(double value) {
+    double scaled = value * 65536.0;
+    return (int32_t)(scaled >= 0.0 ? scaled + 0.5 : scaled - 0.5);
+}
+
+/**
+ * @brief Re-derives the Q16.16 tables from the live double parameters.
+ *
+ * Called lazily before the first quantized evaluation and again by
+ * loadModelParams, so the integer path always mirrors whatever
+ * parameters are in effect.
+ */
+static void refreshQuantizedParams(void) {
+    for (int idx = 0; idx < 9; idx++) {
+        LR_WEIGHTS_Q[idx] = quantizeParam(LR_WEIGHTS[idx]);
+    }
+    LR_BIAS_Q = quantizeParam(LR_BIAS);
+    quantParamsReady = true;
+}
+
+// ============================================================================
+// PARAMETER LOADING
+// ============================================================================
+
+/**
+ * @brief Reads a whole file into a NUL-terminated heap buffer.
+ * @return Buffer (caller frees) or NULL on any I/O failure.
+ */
+static char *readWholeFile(const char *path) {
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) {
+        return NULL;
+    }
+
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    if (size < 0 || size > 1000000L) { // Params file is a few hundred bytes
+        fclose(file);
+        return NULL;
+    }
+    fseek(file, 0, SEEK_SET);
+
+    char *buffer = malloc((size_t)size + 1);
+    if (buffer == NULL) {
+        fclose(file);
+        return NULL;
+    }
+
+    size_t bytesRead = fread(buffer, 1, (size_t)size, file);
+    fclose(file);
+    buffer[bytesRead] = '\0';
+    return buffer;
+}
+
+/**
+ * @brief Loads model parameters from logistic_regression_params.json.
+ *
+ * The parser only needs the two keys the engine consumes ("weights" and
+ * "bias"), so it scans for them directly instead of pulling in a JSON
+ * library. New values are staged locally and only committed to
+ * LR_WEIGHTS/LR_BIAS once the whole file parses, so a truncated or
+ * malformed file leaves the compiled-in defaults untouched.
+ */
+bool loadModelParams(const char *path) {
+    char *buffer = readWholeFile(path);
+    if (buffer == NULL) {
+        return false;
+    }
+
+    double weights[9];
+    double bias;
+
+    // "weights": [ w0, w1, ..., w8 ]
+    const char *cursor = strstr(buffer, "\"weights\"");
+    if (cursor == NULL || (cursor = strchr(cursor, '[')) == NULL) {
+        free(buffer);
+        return false;
+    }
+    cursor++;
+    for (int i = 0; i < 9; i++) {
+        char *end = NULL;
+        weights[i] = strtod(cursor, &end);
+        if (end == cursor) {
+            free(buffer);
+            return false;
+        }
+        cursor = end;
+        while (*cursor == ' ' || *cursor == ',' ||
+               *cursor == '\n' || *cursor == '\r') {
+            cursor++;
+        }
+    }
+    if (*cursor != ']') {
+        free(buffer);
+        return false;
+    }
+
+    // "bias": b
+    cursor = strstr(cursor, "\"bias\"");
+    if (cursor == NULL || (cursor = strchr(cursor, ':')) == NULL) {
+        free(buffer);
+        return false;
+    }
+    cursor++;
+    char *end = NULL;
+    bias = strtod(cursor, &end);
+    if (end == cursor) {
+        free(buffer);
+        return false;
+    }
+
+    free(buffer);
+    memcpy(LR_WEIGHTS, weights, sizeof(weights));
+    LR_BIAS = bias;
+    refreshQuantizedParams(); // Keep the integer inference path in sync
+    return true;
+}
 
 // ============================================================================
 // BOARD EVALUATION FUNCTIONS
@@ -70,50 +214,141 @@ double evaluateBoardLogistic(const char (*board)[3]) {
     return val + LR_BIAS;
 }
 
+// ============================================================================
+// BATCHED EVALUATION
+// ============================================================================
+
+/**
+ * @brief Packs a board into the model's numerical feature layout.
+ */
+void boardToFeatures(const char (*board)[3], signed char features[9]) {
+    int idx = 0;
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j, ++idx) {
+            // X=1, O=-1, Empty=0 (same encoding as evaluateBoardLogistic)
+            if (board[i][j] == 'X') {
+                features[idx] = 1;
+            } else if (board[i][j] == 'O') {
+                features[idx] = -1;
+            } else {
+                features[idx] = 0;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Scores every candidate move of a position in one call.
+ *
+ * OPTIMIZATION: the dot product is linear in the features, so placing a
+ * symbol on empty cell i changes the base score by exactly
+ * +LR_WEIGHTS[i] (X) or -LR_WEIGHTS[i] (O). One base evaluation plus one
+ * add per candidate replaces the old copy-then-full-dot-product per move.
+ */
+int evaluateMovesLogistic(const char (*board)[3], char aiSymbol,
+                          double scores[9]) {
+    signed char features[9];
+    boardToFeatures(board, features);
+
+    // Base score of the position as-is
+    double base = LR_BIAS;
+    for (int idx = 0; idx < 9; ++idx) {
+        base += features[idx] * LR_WEIGHTS[idx];
+    }
+
+    // Placing aiSymbol shifts the dot product by +/- the cell weight
+    double sign = (aiSymbol == 'O') ? -1.0 : 1.0;
+
+    int candidateMask = 0;
+    for (int idx = 0; idx < 9; ++idx) {
+        if (features[idx] == 0) {
+            double moveVal = base + sign * LR_WEIGHTS[idx];
+
+            // For 'O', invert the score since the model is trained for X
+            if (aiSymbol == 'O') {
+                moveVal = -moveVal;
+            }
+
+            scores[idx] = moveVal;
+            candidateMask |= (1 << idx);
+        }
+    }
+
+    return candidateMask;
+}
+
+/**
+ * @brief Evaluates a batch of pre-packed positions in one pass.
+ *
+ * The features sit in one flat array (9 per position) and the inner loop
+ * has a fixed trip count, so the compiler can unroll and vectorize the
+ * whole batch - no per-position board copies or branches on board chars.
+ */
+void evaluateBoardsLogisticBatch(const signed char *features, int count,
+                                 double *scores) {
+    for (int b = 0; b < count; ++b) {
+        const signed char *f = features + b * 9;
+        double val = LR_BIAS;
+        for (int idx = 0; idx < 9; ++idx) {
+            val += f[idx] * LR_WEIGHTS[idx];
+        }
+        scores[b] = val;
+    }
+}
+
 // ============================================================================
 // PUBLIC API FUNCTION
 // ============================================================================
 
 /**
  * @brief Finds the best move using greedy search with logistic regression evaluation.
+ *
+ * OPTIMIZATION: runs entirely on the Q16.16 integer path - one integer
+ * base evaluation, then one add and one compare per candidate. The
+ * float path (evaluateMovesLogistic) produces the same argmax since the
+ * trained weights are separated by far more than the quantization step;
+ * test_findBestMoveModel_quantized_matches_float verifies this across
+ * positions and after parameter reloads.
+ *
  * @param board Current 3x3 game board (not modified).
  * @param aiSymbol The symbol the AI is playing ('X' or 'O').
  * @return The move that results in the highest evaluation score.
  */
 struct Move findBestMoveModel(char (*board)[3], char aiSymbol) {
+    if (!quantParamsReady) {
+        refreshQuantizedParams();
+    }
+
+    signed char features[9];
+    boardToFeatures(board, features);
+
+    // Integer base score of the position as-is
+    int32_t base = LR_BIAS_Q;
+    for (int idx = 0; idx < 9; ++idx) {
+        base += features[idx] * LR_WEIGHTS_Q[idx];
+    }
+
+    // Same incremental trick as evaluateMovesLogistic: placing aiSymbol
+    // on empty cell idx shifts the dot product by +/- that cell's weight,
+    // and for 'O' the whole score is negated (model is trained for X).
+    // Folding the negation in gives one expression for both symbols.
+    int32_t sign = (aiSymbol == 'O') ? -1 : 1;
+
     struct Move bestMove = {-1, -1};
-    double bestVal = -1000.0;
-    
-    // Iterate through all possible moves
-    for (int i = 0; i < 3; i++) {
-        for (int j = 0; j < 3; j++) {
-            
-            if (board[i][j] == ' ') {
-                // Use a local copy to avoid mutating the caller's board
-                char localBoard[3][3];
-                memcpy(localBoard, board, sizeof(localBoard));
-                
-                // Simulate move with AI's actual symbol
-                localBoard[i][j] = aiSymbol;
-                
-                // Evaluate resulting board state
-                double moveVal = evaluateBoardLogistic(localBoard);
-                
-                // For 'O', invert the score since the model is trained for X
-                if (aiSymbol == 'O') {
-                    moveVal = -moveVal;
-                }
-                
-                // Update best move if this score is higher
-                if (moveVal > bestVal) {
-                    bestMove.row = i;
-                    bestMove.col = j;
-                    bestVal = moveVal;
-                }
+    int32_t bestVal = INT32_MIN;
+
+    // Row-major scan keeps the original first-best tie-breaking
+    for (int idx = 0; idx < 9; ++idx) {
+        if (features[idx] == 0) {
+            int32_t moveVal = sign * base + LR_WEIGHTS_Q[idx];
+            if (moveVal > bestVal) {
+                bestMove.row = idx / 3;
+                bestMove.col = idx % 3;
+                bestVal = moveVal;
             }
         }
     }
-    
+
     return bestMove;
 }
 
@@ -10,8 +10,23 @@
 #ifndef MODEL_MINIMAX_H
 #define MODEL_MINIMAX_H
 
+#include <stdbool.h>
 #include "minimax.h" // For struct Move definition
 
+/**
+ * @brief Loads logistic regression parameters from a JSON params file.
+ *
+ * Reads the "weights" array (9 values) and "bias" key from the file the
+ * training pipeline emits (logistic_regression_params.json) and installs
+ * them as the live model parameters. On any failure - missing file,
+ * truncated or malformed content - the compiled-in default parameters
+ * are left untouched, so calling this is always safe at startup.
+ *
+ * @param path Path to the params JSON file
+ * @return true if the parameters were loaded, false otherwise
+ */
+bool loadModelParams(const char *path);
+
 /**
  * @brief Evaluate a board position using logistic regression
  * 
@@ -24,9 +39,55 @@
  */
 double evaluateBoardLogistic(const char board[3][3]);
 
+/**
+ * @brief Packs a board into the model's numerical feature layout.
+ *
+ * Features are X=1, O=-1, Empty=0 in row-major order - the same encoding
+ * evaluateBoardLogistic derives per cell, stored once for reuse.
+ *
+ * @param board 3x3 game board array
+ * @param features Output array of 9 packed features
+ */
+void boardToFeatures(const char board[3][3], signed char features[9]);
+
+/**
+ * @brief Scores every candidate move of a position in one call.
+ *
+ * Computes the base position score once, then derives each move's score
+ * incrementally (placing a symbol on cell i shifts the dot product by
+ * exactly +/- LR_WEIGHTS[i]), so no per-move board copy or re-evaluation
+ * happens. Scores are from aiSymbol's perspective, matching what
+ * findBestMoveModel would compute per move.
+ *
+ * @param board Current 3x3 game board (not modified)
+ * @param aiSymbol The symbol the AI is playing ('X' or 'O')
+ * @param scores Output: scores[pos] filled for every empty cell (pos = row*3+col)
+ * @return Bitmask of the empty cells whose scores were written
+ */
+int evaluateMovesLogistic(const char board[3][3], char aiSymbol, double scores[9]);
+
+/**
+ * @brief Evaluates a batch of pre-packed positions in one pass.
+ *
+ * Positions are 9 contiguous features each (see boardToFeatures); the
+ * fixed-width inner product over a flat array is written so the compiler
+ * can vectorize it, which is what batch scoring pipelines should feed
+ * instead of calling evaluateBoardLogistic per position.
+ *
+ * @param features count * 9 packed features, position-major
+ * @param count Number of positions in the batch
+ * @param scores Output array of count scores
+ */
+void evaluateBoardsLogisticBatch(const signed char *features, int count,
+                                 double *scores);
+
 /**
  * @brief Finds the best move using greedy search with logistic regression evaluation.
- * 
+ *
+ * Inference runs on Q16.16 fixed-point copies of the weights (derived
+ * once per parameter load), so move selection is pure integer arithmetic
+ * with the same argmax as the float evaluation path.
+ *
  * @param board Current 3x3 game board.
  * @param aiSymbol The symbol the AI is playing ('X' or 'O').
  * @return The move that results in the highest evaluation score.
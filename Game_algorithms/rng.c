@@ -0,0 +1,46 @@
+/*
+ * rng.c
+ * Explicit-state fast PRNG (xoroshiro128++) - see rng.h for rationale
+ */
+
+#include "rng.h"
+
+/**
+ * splitmix64 step, used only to expand seeds into initial state.
+ * (The same generator seeds the Zobrist tables in minimax_utils.c.)
+ */
+static uint64_t splitmix64_next(uint64_t *state) {
+    uint64_t z = (*state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+void rngSeed(Rng *rng, uint64_t seed) {
+    rng->s[0] = splitmix64_next(&seed);
+    rng->s[1] = splitmix64_next(&seed);
+}
+
+static uint64_t rotl64(uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+}
+
+uint64_t rngNext(Rng *rng) {
+    // xoroshiro128++ (Blackman & Vigna): a rotation-based scrambler over
+    // a 128-bit linear engine - a few cycles per draw, period 2^128 - 1
+    uint64_t s0 = rng->s[0];
+    uint64_t s1 = rng->s[1];
+    uint64_t result = rotl64(s0 + s1, 17) + s0;
+
+    s1 ^= s0;
+    rng->s[0] = rotl64(s0, 49) ^ s1 ^ (s1 << 21);
+    rng->s[1] = rotl64(s1, 28);
+    return result;
+}
+
+int rngRange(Rng *rng, int bound) {
+    // Multiply-shift bounding: maps the 32 high bits into [0, bound)
+    // using the top of the product, so no modulo and no low-bit bias
+    uint32_t x = (uint32_t)(rngNext(rng) >> 32);
+    return (int)(((uint64_t)x * (uint64_t)(uint32_t)bound) >> 32);
+}
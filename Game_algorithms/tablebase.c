@@ -0,0 +1,170 @@
+/*
+ * tablebase.c
+ * Precomputed perfect-play tablebase backing findBestMoveMinimax
+ */
+
+#include "tablebase.h"
+#include "minimax_utils.h"
+#include <stdbool.h>
+#include <stdlib.h>
+
+// ============================================================================
+// STORAGE
+// ============================================================================
+
+/**
+ * Table size: 9 bits of aiMask concatenated with 9 bits of oppMask.
+ * Most of the 2^18 slots correspond to illegal (overlapping) masks and
+ * stay 0; the memory cost (512 KB of uint16) is a fair trade for turning
+ * the hottest function in the simulation farm into one array load.
+ */
+#define TB_SIZE (1 << 18)
+
+/** Per-position bitmask of optimal moves (bits 0-8). 0 = no entry. */
+static unsigned short tb_candidates[TB_SIZE];
+
+static bool tb_ready = false;
+
+// ============================================================================
+// GENERATION (MEMOIZED SOLVE)
+// ============================================================================
+
+/**
+ * Memo of depth-relative minimax values, one layer per side on the move.
+ * Values use the same scoring as minimax_masks but measured from the
+ * memoized node (depth 0): +10 = maximizer already won, decaying by one
+ * per ply, 0 = draw. TB_UNSOLVED marks empty slots.
+ */
+#define TB_UNSOLVED (-128)
+
+static signed char *tb_memo[2]; // [isMax][key]
+
+/**
+ * @brief Shifts a child value one ply closer to the root.
+ *
+ * Mirrors the "10 - depth" / "-10 + depth" scoring of minimax_masks:
+ * wins further in the future are worth one point less per ply.
+ */
+static int tb_shift(int val) {
+  if (val > 0)
+    return val - 1;
+  if (val < 0)
+    return val + 1;
+  return 0;
+}
+
+/**
+ * @brief Memoized minimax over bitmasks (no pruning - exact values).
+ *
+ * playerMask is always the AI side (the maximizer), matching the
+ * conventions of minimax_masks in Minimax.c.
+ */
+static int tb_solve(int playerMask, int oppMask, bool isMax) {
+  int key = (playerMask << 9) | oppMask;
+  signed char *slot = &tb_memo[isMax ? 1 : 0][key];
+  if (*slot != TB_UNSOLVED)
+    return *slot;
+
+  int result;
+  if (isWinnerMask(playerMask)) {
+    result = 10;
+  } else if (isWinnerMask(oppMask)) {
+    result = -10;
+  } else if ((playerMask | oppMask) == 0x1FF) {
+    result = 0; // Draw
+  } else {
+    int best = isMax ? -1000 : 1000;
+    for (int pos = 0; pos < 9; ++pos) {
+      int bit = (1 << pos);
+      if ((playerMask | oppMask) & bit)
+        continue;
+
+      int val;
+      if (isMax)
+        val = tb_shift(tb_solve(playerMask | bit, oppMask, false));
+      else
+        val = tb_shift(tb_solve(playerMask, oppMask | bit, true));
+
+      if (isMax ? (val > best) : (val < best))
+        best = val;
+    }
+    result = best;
+  }
+
+  *slot = (signed char)result;
+  return result;
+}
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+void initMinimaxTablebase(void) {
+  if (tb_ready)
+    return;
+
+  // The memo is only needed during generation; free it afterwards.
+  tb_memo[0] = (signed char *)malloc(TB_SIZE);
+  tb_memo[1] = (signed char *)malloc(TB_SIZE);
+  if (tb_memo[0] == NULL || tb_memo[1] == NULL) {
+    free(tb_memo[0]);
+    free(tb_memo[1]);
+    tb_memo[0] = tb_memo[1] = NULL;
+    return; // Leave tb_ready false: engine falls back to the search
+  }
+  for (int i = 0; i < TB_SIZE; ++i) {
+    tb_memo[0][i] = TB_UNSOLVED;
+    tb_memo[1][i] = TB_UNSOLVED;
+  }
+
+  /*
+   * Enumerate every pair of disjoint masks with the first mask to move.
+   * Only ~3^9 pairs are legal; everything else keeps candidates == 0.
+   */
+  for (int aiMask = 0; aiMask < 512; ++aiMask) {
+    for (int oppMask = 0; oppMask < 512; ++oppMask) {
+      if (aiMask & oppMask)
+        continue; // Overlapping masks - not a board
+      if (isWinnerMask(aiMask) || isWinnerMask(oppMask))
+        continue; // Terminal - no move to serve
+      if ((aiMask | oppMask) == 0x1FF)
+        continue; // Full board
+
+      // Same evaluation findBestMoveMinimax performs per top-level probe:
+      // score each empty cell and keep every move tied for the maximum.
+      int bestVal = -1000;
+      int candMask = 0;
+      for (int pos = 0; pos < 9; ++pos) {
+        int bit = (1 << pos);
+        if ((aiMask | oppMask) & bit)
+          continue;
+
+        int moveVal = tb_shift(tb_solve(aiMask | bit, oppMask, false));
+        if (moveVal > bestVal) {
+          bestVal = moveVal;
+          candMask = bit;
+        } else if (moveVal == bestVal) {
+          candMask |= bit;
+        }
+      }
+
+      tb_candidates[(aiMask << 9) | oppMask] = (unsigned short)candMask;
+    }
+  }
+
+  free(tb_memo[0]);
+  free(tb_memo[1]);
+  tb_memo[0] = tb_memo[1] = NULL;
+
+  tb_ready = true;
+}
+
+bool isTablebaseReady(void) { return tb_ready; }
+
+int tablebaseLookup(int aiMask, int oppMask) {
+  if (!tb_ready)
+    return 0;
+  if (aiMask < 0 || aiMask > 0x1FF || oppMask < 0 || oppMask > 0x1FF)
+    return 0;
+  return tb_candidates[(aiMask << 9) | oppMask];
+}
@@ -0,0 +1,47 @@
+/**
+ * @file tablebase.h
+ * @brief Precomputed perfect-play tablebase for the minimax engine
+ *
+ * Tic-Tac-Toe has only a few thousand reachable positions, so instead of
+ * re-running the full minimax search for every call, the engine can serve
+ * the best move (and the complete list of equally-good moves, so the
+ * tie-randomization in findBestMoveMinimax keeps working) from a table
+ * indexed by (aiMask << 9) | oppMask.
+ *
+ * The table is generated once at startup by a memoized solve over every
+ * legal (aiMask, oppMask) pair. After that, a "best move" query is a
+ * single array load. The recursive search in Minimax.c remains as the
+ * fallback (and verification) path whenever the table has not been built.
+ */
+
+#ifndef TABLEBASE_H
+#define TABLEBASE_H
+
+#include <stdbool.h>
+
+/**
+ * @brief Builds the full-game tablebase (idempotent).
+ *
+ * Solves every legal position once using a memoized minimax and stores,
+ * per position, the bitmask of all optimal moves for the side to move.
+ * Takes a few milliseconds; call it once at program startup.
+ */
+void initMinimaxTablebase(void);
+
+/**
+ * @brief Returns true once initMinimaxTablebase() has completed.
+ */
+bool isTablebaseReady(void);
+
+/**
+ * @brief Looks up the optimal-move candidates for a position.
+ *
+ * @param aiMask  Bitmask of the side to move (the "AI" in Minimax.c terms)
+ * @param oppMask Bitmask of the opponent
+ * @return Bitmask (bits 0-8) of all moves that preserve the optimal
+ *         outcome, or 0 if the table is not built or the position is
+ *         terminal/invalid (callers must then fall back to the search).
+ */
+int tablebaseLookup(int aiMask, int oppMask);
+
+#endif // TABLEBASE_H
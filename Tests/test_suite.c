@@ -13,7 +13,7 @@
  *   - Edge cases
  *
  * COMPILATION:
- * gcc -o Tests\test_suite.exe Tests\test_suite.c Tests\raylib_stub.c Game_algorithms\Minimax.c Game_algorithms\minimax_utils.c Game_algorithms\model_minimax.c -Ilib\raylib -I. -lm
+ * gcc -o Tests\test_suite.exe Tests\test_suite.c Tests\raylib_stub.c Game_algorithms\Minimax.c Game_algorithms\minimax_utils.c Game_algorithms\model_minimax.c Game_algorithms\tablebase.c Game_algorithms\minimax_nxn.c -Ilib\raylib -I. -lm
  */
 
 #include <stdio.h>
@@ -22,9 +22,14 @@
 #include <stdbool.h>
 #include <time.h>
 #include "GUI_handlers/game_state.h"
+#include "GUI_handlers/game_record.h"
+#include "GUI_handlers/profiler.h"
+#include "GUI_handlers/resource_cache.h"
 #include "Game_algorithms/minimax.h"
 #include "Game_algorithms/minimax_utils.h"
 #include "Game_algorithms/model_minimax.h"
+#include "Game_algorithms/tablebase.h"
+#include "Game_algorithms/minimax_nxn.h"
 
 // ============================================================================
 // TEST FRAMEWORK
@@ -118,8 +123,17 @@ static void reset_game_for_test(void) {
     game.historyLineCount = 0;
     game.historyCapacity = 0;
     game.historyScrollOffset = 0;
+    game.historyIndex = NULL;
+    game.historyIndexCapacity = 0;
+    game.historyFileSize = 0;
+    game.historyPageStart = 0;
+    game.historyPageCount = 0;
+    game.movesPlayedCount = 0;
+    game.movesKnown = true;
     game.simTimer = 0.0f;
     game.simStep = 0;
+    // Set up the per-game delta arena (undo/replay paths rely on it)
+    ResetBoard();
     // Note: sfx sounds are stubbed, no need to load
 }
 
@@ -148,6 +162,87 @@ TEST(test_countBits_multiple_bits) {
     tests_passed++;
 }
 
+TEST(test_MOVE_LISTS_matches_move_order_scan) {
+    // Every packed entry must list exactly the free cells of its
+    // occupancy, in MOVE_ORDER, with the count in the low nibble
+    for (int occupied = 0; occupied < 512; occupied++) {
+        unsigned long long list = MOVE_LISTS[occupied];
+        int count = (int)(list & 0xF);
+        list >>= 4;
+
+        ASSERT_EQ_INT(9 - countBits(occupied), count);
+
+        int emitted = 0;
+        for (int mi = 0; mi < 9; mi++) {
+            int pos = MOVE_ORDER[mi];
+            if (occupied & (1 << pos)) continue;
+            ASSERT_EQ_INT(pos, (int)((list >> (4 * emitted)) & 0xF));
+            emitted++;
+        }
+        ASSERT_EQ_INT(count, emitted);
+    }
+    printf("PASS\n");
+    tests_passed++;
+}
+
+TEST(test_findImmediateWin_detects_open_lines) {
+    // Two in the top row, third cell empty: cell 2 wins
+    ASSERT_EQ_INT(2, findImmediateWin(0x3, 0));
+    // Same line but the opponent holds cell 2: no win there
+    ASSERT_EQ_INT(-1, findImmediateWin(0x3, 0x4));
+    // Two on the main diagonal (bits 0,4): cell 8 wins
+    ASSERT_EQ_INT(8, findImmediateWin(0x11, 0x2));
+    // One piece per line only: nothing to complete
+    ASSERT_EQ_INT(-1, findImmediateWin(0x1, 0));
+    // Swapped masks find the cell the threatened player must block
+    ASSERT_EQ_INT(2, findImmediateWin(0x3, 0x8));
+    printf("PASS\n");
+    tests_passed++;
+}
+
+TEST(test_zobrist_incremental_matches_full_hash) {
+    initZobristKeys();
+
+    // Play out a move sequence maintaining the hash incrementally; after
+    // every ply it must equal a from-scratch recompute of the masks
+    int player = 0, opp = 0;
+    uint64_t hash = zobristHashMasks(player, opp);
+    const int sequence[6] = {4, 0, 2, 6, 8, 1};
+
+    for (int ply = 0; ply < 6; ply++) {
+        int pos = sequence[ply];
+        int side = ply % 2; // Side 0 moved first
+        if (side == 0) player |= (1 << pos);
+        else opp |= (1 << pos);
+
+        hash ^= ZOBRIST_KEYS[side][pos];
+        ASSERT_TRUE(hash == zobristHashMasks(player, opp));
+    }
+
+    // Unmake the last move: one XOR restores the previous hash
+    hash ^= ZOBRIST_KEYS[1][1];
+    ASSERT_TRUE(hash == zobristHashMasks(player, opp & ~(1 << 1)));
+    printf("PASS\n");
+    tests_passed++;
+}
+
+TEST(test_zobrist_distinguishes_positions) {
+    initZobristKeys();
+
+    // Same cell, different side: different hash
+    ASSERT_TRUE(zobristHashMasks(0x10, 0) != zobristHashMasks(0, 0x10));
+    // Empty board hashes to zero XOR of nothing, any stone changes it
+    ASSERT_TRUE(zobristHashMasks(0, 0) != zobristHashMasks(0x1, 0));
+    // The side-to-move key is distinct from every cell key it composes with
+    ASSERT_TRUE((zobristHashMasks(0x10, 0) ^ ZOBRIST_SIDE_KEY) !=
+                zobristHashMasks(0x10, 0));
+    // 64-bit variant agrees with the 3x3 one on 9-bit masks
+    ASSERT_TRUE(zobristHashMasks(0x1B, 0x24) ==
+                zobristHashMasks64(0x1B, 0x24));
+    printf("PASS\n");
+    tests_passed++;
+}
+
 TEST(test_isWinnerMask_no_winner) {
     // Empty board
     ASSERT_FALSE(isWinnerMask(0));
@@ -272,10 +367,189 @@ TEST(test_getPlayerMasks_ai_is_O) {
     tests_passed++;
 }
 
+TEST(test_transformMask_identity) {
+    ASSERT_EQ_INT(0x7, transformMask(0x7, 0));
+    ASSERT_EQ_INT(0x155, transformMask(0x155, 0));
+    printf("PASS\n");
+    tests_passed++;
+}
+
+TEST(test_transformMask_rotation_cycle) {
+    // Rotating four times by 90 degrees must return the original mask
+    int mask = (1 << 0) | (1 << 1) | (1 << 5); // asymmetric pattern
+    int rotated = mask;
+    for (int i = 0; i < 4; i++) {
+        rotated = transformMask(rotated, 1);
+    }
+    ASSERT_EQ_INT(mask, rotated);
+    printf("PASS\n");
+    tests_passed++;
+}
+
+TEST(test_canonicalizeMasks_symmetric_variants_agree) {
+    // All rotations/reflections of a position must share one canonical form
+    int playerMask = (1 << 0) | (1 << 4); // corner + center
+    int oppMask = (1 << 1);
+    int canonP, canonO;
+    canonicalizeMasks(playerMask, oppMask, &canonP, &canonO);
+
+    for (int s = 1; s < NUM_SYMMETRIES; s++) {
+        int p2 = transformMask(playerMask, s);
+        int o2 = transformMask(oppMask, s);
+        int cp, co;
+        canonicalizeMasks(p2, o2, &cp, &co);
+        ASSERT_EQ_INT(canonP, cp);
+        ASSERT_EQ_INT(canonO, co);
+    }
+    printf("PASS\n");
+    tests_passed++;
+}
+
+TEST(test_isWinnerMaskAt_matches_isWinnerMask) {
+    // For any mask and last-move cell inside it, the restricted check
+    // must agree with the full 8-line scan
+    for (int i = 0; i < 8; i++) {
+        int winMask = WIN_MASKS[i];
+        for (int pos = 0; pos < 9; pos++) {
+            if (winMask & (1 << pos)) {
+                ASSERT_TRUE(isWinnerMaskAt(winMask, pos));
+            }
+        }
+    }
+
+    // Two stones on a line is not a win through any of its cells
+    int twoOnRow = (1 << 0) | (1 << 1);
+    ASSERT_FALSE(isWinnerMaskAt(twoOnRow, 0));
+    ASSERT_FALSE(isWinnerMaskAt(twoOnRow, 1));
+
+    // A win elsewhere is invisible from an unrelated cell's lines
+    int bottomRow = (1 << 6) | (1 << 7) | (1 << 8);
+    ASSERT_FALSE(isWinnerMaskAt(bottomRow | (1 << 1), 1));
+    printf("PASS\n");
+    tests_passed++;
+}
+
+TEST(test_rng_seeded_sequences_reproduce) {
+    // Same seed must replay the identical stream; a different seed must
+    // diverge (this is what makes recorded simulation seeds re-runnable)
+    Rng a, b, c;
+    rngSeed(&a, 12345);
+    rngSeed(&b, 12345);
+    rngSeed(&c, 54321);
+
+    int diverged = 0;
+    for (int i = 0; i < 100; i++) {
+        uint64_t va = rngNext(&a);
+        ASSERT_TRUE(va == rngNext(&b));
+        if (va != rngNext(&c)) diverged = 1;
+    }
+    ASSERT_TRUE(diverged);
+    printf("PASS\n");
+    tests_passed++;
+}
+
+TEST(test_rngRange_stays_in_bounds_and_covers) {
+    // Every draw lands in [0, bound) and every bucket is eventually hit
+    // for the small bounds the engine actually uses (9 cells, 100 percent)
+    Rng rng;
+    rngSeed(&rng, 2026);
+
+    int seen[9] = {0};
+    for (int i = 0; i < 2000; i++) {
+        int v = rngRange(&rng, 9);
+        ASSERT_TRUE(v >= 0 && v < 9);
+        seen[v] = 1;
+
+        int pct = rngRange(&rng, 100);
+        ASSERT_TRUE(pct >= 0 && pct < 100);
+    }
+    for (int i = 0; i < 9; i++) {
+        ASSERT_TRUE(seen[i]);
+    }
+    printf("PASS\n");
+    tests_passed++;
+}
+
+TEST(test_findBestMoveMinimaxRng_replays_with_same_seed) {
+    // An imperfect search re-run from the same seed must pick the same
+    // moves - the property the simulation/tournament seed lines rely on
+    char board[3][3] = {
+        {'X', ' ', ' '},
+        {' ', 'O', ' '},
+        {' ', ' ', ' '}
+    };
+
+    for (int trial = 0; trial < 20; trial++) {
+        Rng a, b;
+        rngSeed(&a, 9000 + (uint64_t)trial);
+        rngSeed(&b, 9000 + (uint64_t)trial);
+        struct Move ma = findBestMoveMinimaxRng(board, 'X', 60, &a);
+        struct Move mb = findBestMoveMinimaxRng(board, 'X', 60, &b);
+        ASSERT_EQ_INT(ma.row, mb.row);
+        ASSERT_EQ_INT(ma.col, mb.col);
+    }
+    printf("PASS\n");
+    tests_passed++;
+}
+
 // ============================================================================
 // TEST GROUP 2: CHECK WINNER (game_state.c)
 // ============================================================================
 
+TEST(test_PlaceSymbol_keeps_masks_in_sync) {
+    reset_game_for_test();
+    PlaceSymbol(0, 0, 'X');
+    PlaceSymbol(1, 1, 'O');
+    PlaceSymbol(2, 2, 'X');
+
+    ASSERT_EQ_INT((1 << 0) | (1 << 8), game.maskX);
+    ASSERT_EQ_INT(1 << 4, game.maskO);
+    ASSERT_EQ_CHAR('X', game.board[0][0]);
+    ASSERT_EQ_CHAR('O', game.board[1][1]);
+
+    // Rebuilding from the board must reproduce the incremental masks
+    int savedX = game.maskX, savedO = game.maskO;
+    RebuildBoardMasks();
+    ASSERT_EQ_INT(savedX, game.maskX);
+    ASSERT_EQ_INT(savedO, game.maskO);
+    printf("PASS\n");
+    tests_passed++;
+}
+
+TEST(test_CheckWinnerAt_detects_completed_line) {
+    reset_game_for_test();
+    PlaceSymbol(0, 0, 'X');
+    PlaceSymbol(0, 1, 'X');
+
+    // Two in a row is not yet a win
+    ASSERT_FALSE(CheckWinnerAt(0, 1));
+
+    // Completing the top row is detected at the moved cell
+    PlaceSymbol(0, 2, 'X');
+    ASSERT_TRUE(CheckWinnerAt(0, 2));
+    ASSERT_EQ_CHAR('X', game.winner);
+    printf("PASS\n");
+    tests_passed++;
+}
+
+TEST(test_IsBoardFullMask_draw) {
+    reset_game_for_test();
+    board_from_string(game.board, "XOXXOOOXX");
+    RebuildBoardMasks();
+
+    ASSERT_TRUE(IsBoardFullMask());
+    ASSERT_EQ_INT(1, game.draws);
+
+    // One empty cell: not full, draw counter untouched
+    reset_game_for_test();
+    board_from_string(game.board, "XOXXOOOX ");
+    RebuildBoardMasks();
+    ASSERT_FALSE(IsBoardFullMask());
+    ASSERT_EQ_INT(0, game.draws);
+    printf("PASS\n");
+    tests_passed++;
+}
+
 TEST(test_CheckWinner_empty_board) {
     reset_game_for_test();
     char board[3][3] = {
@@ -574,6 +848,75 @@ TEST(test_ResetBoard_resets_move_count) {
     tests_passed++;
 }
 
+TEST(test_UndoLastMove_reverts_single_move) {
+    reset_game_for_test();
+    game.mode = MODE_TWO_PLAYER;
+
+    PushMoveDelta(1, 1, 'X', false);
+    PlaceSymbol(1, 1, 'X');
+    game.currentPlayer = 'O';
+
+    ASSERT_TRUE(UndoLastMove());
+    ASSERT_EQ_CHAR(' ', game.board[1][1]);
+    ASSERT_EQ_INT(0, game.maskX);
+    ASSERT_EQ_INT(0, game.movesPlayedCount);
+    ASSERT_EQ_CHAR('X', game.currentPlayer); // Restored from the delta
+    ASSERT_EQ_INT(0, game.moveCount);
+    printf("PASS\n");
+    tests_passed++;
+}
+
+TEST(test_UndoLastMove_pops_ai_reply_with_human_move) {
+    reset_game_for_test();
+    game.mode = MODE_ONE_PLAYER;
+
+    // Human X plays center, then the AI reply lands on top of it
+    PushMoveDelta(1, 1, 'X', false);
+    PlaceSymbol(1, 1, 'X');
+    game.currentPlayer = 'O';
+    game.aiTurn = true;
+
+    struct Move reply = {0, 0};
+    ApplyAIMove(reply); // Pushes its own byAI delta
+
+    ASSERT_EQ_INT(2, game.moveCount);
+
+    // One undo reverts both plies and hands the turn back to the human
+    ASSERT_TRUE(UndoLastMove());
+    ASSERT_EQ_CHAR(' ', game.board[1][1]);
+    ASSERT_EQ_CHAR(' ', game.board[0][0]);
+    ASSERT_EQ_INT(0, game.maskX | game.maskO);
+    ASSERT_EQ_CHAR('X', game.currentPlayer);
+    ASSERT_FALSE(game.aiTurn);
+    ASSERT_EQ_INT(0, game.moveCount);
+    printf("PASS\n");
+    tests_passed++;
+}
+
+TEST(test_UndoLastMove_reopens_finished_game) {
+    reset_game_for_test();
+    game.mode = MODE_TWO_PLAYER;
+
+    PushMoveDelta(0, 2, 'X', false);
+    PlaceSymbol(0, 2, 'X');
+    game.gameOver = true;
+    game.winner = 'X';
+
+    ASSERT_TRUE(UndoLastMove());
+    ASSERT_FALSE(game.gameOver);
+    ASSERT_EQ_CHAR(' ', game.winner);
+    printf("PASS\n");
+    tests_passed++;
+}
+
+TEST(test_UndoLastMove_empty_stack_fails) {
+    reset_game_for_test();
+
+    ASSERT_FALSE(UndoLastMove());
+    printf("PASS\n");
+    tests_passed++;
+}
+
 // ============================================================================
 // TEST GROUP 5: MINIMAX AI - PERFECT PLAY (Minimax.c)
 // ============================================================================
@@ -633,6 +976,19 @@ TEST(test_minimax_winning_move_anti_diag) {
     tests_passed++;
 }
 
+TEST(test_minimax_imperfect_never_misses_own_win) {
+    // The tactical layer runs before the error roll, so even a 100%
+    // error rate must take the one-move win every time
+    char board[3][3];
+    for (int i = 0; i < 50; i++) {
+        board_from_string(board, "XX  O O  ");
+        struct Move move = findBestMoveMinimax(board, 'X', 100);
+        ASSERT_TRUE(move.row == 0 && move.col == 2);
+    }
+    printf("PASS\n");
+    tests_passed++;
+}
+
 TEST(test_minimax_blocks_opponent_win) {
     // X to move, O is threatening top row (has O at 0,1)
     char board[3][3];
@@ -777,6 +1133,37 @@ TEST(test_minimax_full_board_returns_invalid) {
     tests_passed++;
 }
 
+TEST(test_search_stats_collection) {
+    // NOTE: Runs before the tablebase group initializes the table, so the
+    // search below actually recurses instead of being served by a lookup.
+    char board[3][3];
+    board_from_string(board, "X O      ");
+
+    SearchStats stats;
+    minimaxAttachStats(&stats);
+    struct Move move = findBestMoveMinimax(board, 'O', 0);
+    minimaxAttachStats(NULL);
+
+    ASSERT_TRUE(move.row != -1 && move.col != -1);
+    ASSERT_TRUE(stats.nodes > 0);
+    ASSERT_TRUE(stats.terminals > 0);
+    ASSERT_TRUE(stats.maxDepth >= 1);
+    ASSERT_TRUE(stats.cutoffs >= 0);
+    ASSERT_TRUE(stats.elapsedMs >= 0.0);
+    // Every node is at most one of: terminal, tt hit, or interior
+    ASSERT_TRUE(stats.terminals + stats.ttHits <= stats.nodes);
+
+    // A fresh search must reset the counters, not accumulate: with the
+    // transposition table now warm it cannot visit more nodes than run one
+    long firstNodes = stats.nodes;
+    minimaxAttachStats(&stats);
+    findBestMoveMinimax(board, 'O', 0);
+    minimaxAttachStats(NULL);
+    ASSERT_TRUE(stats.nodes <= firstNodes);
+    printf("PASS\n");
+    tests_passed++;
+}
+
 TEST(test_minimax_forks_creates_double_threat) {
     // Classic fork: X at center, O at corner.
     // X can create a fork (double threat).
@@ -886,6 +1273,181 @@ TEST(test_model_ai_full_board_no_crash) {
     tests_passed++;
 }
 
+TEST(test_evaluateMovesLogistic_matches_scalar) {
+    // Batched incremental scores must equal the copy-and-evaluate path
+    char board[3][3];
+    board_from_string(board, "X O  O X ");
+
+    char symbols[2] = {'X', 'O'};
+    for (int s = 0; s < 2; s++) {
+        double scores[9];
+        int candidateMask = evaluateMovesLogistic(board, symbols[s], scores);
+
+        for (int idx = 0; idx < 9; idx++) {
+            if (board[idx / 3][idx % 3] != ' ') {
+                ASSERT_TRUE((candidateMask & (1 << idx)) == 0);
+                continue;
+            }
+            ASSERT_TRUE((candidateMask & (1 << idx)) != 0);
+
+            char localBoard[3][3];
+            memcpy(localBoard, board, sizeof(localBoard));
+            localBoard[idx / 3][idx % 3] = symbols[s];
+            double expected = evaluateBoardLogistic(localBoard);
+            if (symbols[s] == 'O') expected = -expected;
+
+            double diff = scores[idx] - expected;
+            ASSERT_TRUE(diff > -1e-9 && diff < 1e-9);
+        }
+    }
+    printf("PASS\n");
+    tests_passed++;
+}
+
+TEST(test_evaluateBoardsLogisticBatch_matches_scalar) {
+    const char *positions[3] = {"         ", "XX  X    ", "XOXOXOOX "};
+    signed char features[3 * 9];
+    char boards[3][3][3];
+
+    for (int b = 0; b < 3; b++) {
+        board_from_string(boards[b], positions[b]);
+        boardToFeatures(boards[b], features + b * 9);
+    }
+
+    double scores[3];
+    evaluateBoardsLogisticBatch(features, 3, scores);
+
+    for (int b = 0; b < 3; b++) {
+        double diff = scores[b] - evaluateBoardLogistic(boards[b]);
+        ASSERT_TRUE(diff > -1e-9 && diff < 1e-9);
+    }
+    printf("PASS\n");
+    tests_passed++;
+}
+
+// The live model parameters, writable since the training pipeline loads
+// them at runtime (see loadModelParams)
+extern double LR_WEIGHTS[9];
+extern double LR_BIAS;
+
+TEST(test_loadModelParams_round_trip) {
+    const char *path = "test_params_tmp.json";
+
+    // Save the shipped parameters so later model tests see them again
+    double savedWeights[9];
+    double savedBias = LR_BIAS;
+    memcpy(savedWeights, LR_WEIGHTS, sizeof(savedWeights));
+
+    // Emit a params file in the training pipeline's format
+    FILE *file = fopen(path, "w");
+    ASSERT_TRUE(file != NULL);
+    fprintf(file, "{\n  \"model_type\": \"logistic_regression\",\n");
+    fprintf(file, "  \"weights\": [\n");
+    for (int j = 0; j < 9; j++) {
+        fprintf(file, "    %.17g%s\n", 0.5 + j, (j < 8) ? "," : "");
+    }
+    fprintf(file, "  ],\n  \"bias\": -2.25,\n");
+    fprintf(file, "  \"classes\": [0, 1],\n  \"n_features\": 9\n}\n");
+    fclose(file);
+
+    ASSERT_TRUE(loadModelParams(path));
+    for (int j = 0; j < 9; j++) {
+        double diff = LR_WEIGHTS[j] - (0.5 + j);
+        ASSERT_TRUE(diff > -1e-12 && diff < 1e-12);
+    }
+    ASSERT_TRUE(LR_BIAS == -2.25);
+
+    // Restore the shipped parameters through the loader so derived state
+    // (the quantized inference tables) is refreshed along with them
+    file = fopen(path, "w");
+    ASSERT_TRUE(file != NULL);
+    fprintf(file, "{\n  \"weights\": [\n");
+    for (int j = 0; j < 9; j++) {
+        fprintf(file, "    %.17g%s\n", savedWeights[j], (j < 8) ? "," : "");
+    }
+    fprintf(file, "  ],\n  \"bias\": %.17g\n}\n", savedBias);
+    fclose(file);
+    ASSERT_TRUE(loadModelParams(path));
+    ASSERT_TRUE(LR_BIAS == savedBias);
+
+    remove(path);
+    printf("PASS\n");
+    tests_passed++;
+}
+
+TEST(test_findBestMoveModel_quantized_matches_float) {
+    // The quantized integer path must pick the same move as a float
+    // argmax over evaluateMovesLogistic for every position either side
+    // could face. Enumerate all disjoint mask pairs with a plausible
+    // piece-count difference; that covers every reachable position (and
+    // then some) for a few million integer ops.
+    for (int maskX = 0; maskX < 512; maskX++) {
+        for (int maskO = 0; maskO < 512; maskO++) {
+            if ((maskX & maskO) != 0) continue;
+            int diff = countBits(maskX) - countBits(maskO);
+            if (diff < -1 || diff > 1) continue;
+            if ((maskX | maskO) == 0x1FF) continue; // Full board
+
+            char board[3][3];
+            for (int idx = 0; idx < 9; idx++) {
+                board[idx / 3][idx % 3] =
+                    (maskX & (1 << idx)) ? 'X' :
+                    (maskO & (1 << idx)) ? 'O' : ' ';
+            }
+
+            char symbols[2] = {'X', 'O'};
+            for (int s = 0; s < 2; s++) {
+                // Reference argmax with the same first-best tie-break
+                double scores[9];
+                int candidateMask =
+                    evaluateMovesLogistic(board, symbols[s], scores);
+                int expected = -1;
+                double bestVal = -1000.0;
+                for (int idx = 0; idx < 9; idx++) {
+                    if ((candidateMask & (1 << idx)) &&
+                        scores[idx] > bestVal) {
+                        expected = idx;
+                        bestVal = scores[idx];
+                    }
+                }
+
+                struct Move move = findBestMoveModel(board, symbols[s]);
+                ASSERT_EQ_INT(expected, move.row * 3 + move.col);
+            }
+        }
+    }
+    printf("PASS\n");
+    tests_passed++;
+}
+
+TEST(test_loadModelParams_rejects_malformed) {
+    const char *path = "test_params_tmp.json";
+
+    double savedWeights[9];
+    double savedBias = LR_BIAS;
+    memcpy(savedWeights, LR_WEIGHTS, sizeof(savedWeights));
+
+    // Truncated file: weights array ends after three values
+    FILE *file = fopen(path, "w");
+    ASSERT_TRUE(file != NULL);
+    fprintf(file, "{\n  \"weights\": [1.0, 2.0, 3.0]\n}\n");
+    fclose(file);
+
+    // Load must fail and leave the live parameters untouched
+    ASSERT_TRUE(!loadModelParams(path));
+    for (int j = 0; j < 9; j++) {
+        ASSERT_TRUE(LR_WEIGHTS[j] == savedWeights[j]);
+    }
+    ASSERT_TRUE(LR_BIAS == savedBias);
+
+    // Missing file must fail the same way
+    remove(path);
+    ASSERT_TRUE(!loadModelParams(path));
+
+    printf("PASS\n");
+    tests_passed++;
+}
+
 // ============================================================================
 // TEST GROUP 7: THEME MANAGEMENT (game_state.c)
 // ============================================================================
@@ -952,6 +1514,7 @@ TEST(test_MakeAIMove_hard_difficulty) {
     game.humanSymbol = 'X';
     // X has played center, AI should respond
     board_from_string(game.board, "   X X   ");
+    RebuildBoardMasks(); // Direct board writes bypass PlaceSymbol
 
     MakeAIMove();
 
@@ -973,6 +1536,7 @@ TEST(test_MakeAIMove_medium_difficulty) {
     game.humanSymbol = 'X';
 
     board_from_string(game.board, "   X X   ");
+    RebuildBoardMasks();
 
     // Run many times to ensure it doesn't crash
     for (int i = 0; i < 50; i++) {
@@ -980,6 +1544,7 @@ TEST(test_MakeAIMove_medium_difficulty) {
         memcpy(tempBoard, game.board, sizeof(game.board));
         MakeAIMove();
         memcpy(game.board, tempBoard, sizeof(game.board));
+        RebuildBoardMasks(); // Re-sync masks after the wholesale restore
     }
     printf("PASS\n");
     tests_passed++;
@@ -992,6 +1557,7 @@ TEST(test_MakeAIMove_easy_difficulty) {
     game.humanSymbol = 'X';
 
     board_from_string(game.board, "   X X   ");
+    RebuildBoardMasks();
 
     // Run many times to ensure it doesn't crash
     for (int i = 0; i < 50; i++) {
@@ -999,6 +1565,7 @@ TEST(test_MakeAIMove_easy_difficulty) {
         memcpy(tempBoard, game.board, sizeof(game.board));
         MakeAIMove();
         memcpy(game.board, tempBoard, sizeof(game.board));
+        RebuildBoardMasks(); // Re-sync masks after the wholesale restore
     }
     printf("PASS\n");
     tests_passed++;
@@ -1012,6 +1579,7 @@ TEST(test_MakeAIMove_winning_move) {
 
     // O can win by completing top row
     board_from_string(game.board, "OO  X    ");
+    RebuildBoardMasks();
     MakeAIMove();
 
     // O should have taken position (0,2) to win
@@ -1020,6 +1588,52 @@ TEST(test_MakeAIMove_winning_move) {
     tests_passed++;
 }
 
+TEST(test_async_ai_search_round_trip) {
+    reset_game_for_test();
+    game.difficulty = DIFF_HARD;
+    game.aiSymbol = 'O';
+    game.humanSymbol = 'X';
+
+    // O must block X's completed pair on the top row
+    board_from_string(game.board, "XX  O    ");
+    RebuildBoardMasks();
+
+    ASSERT_TRUE(SubmitAIMoveSearch());
+    // A second submission while one is in flight must be refused
+    ASSERT_FALSE(SubmitAIMoveSearch());
+
+    // Spin until the worker finishes (a 3x3 search is near-instant)
+    struct Move move;
+    long spins = 0;
+    while (!TakeAIMoveResult(&move)) {
+        ASSERT_TRUE(++spins < 100000000L);
+    }
+
+    // Result is not applied until ApplyAIMove, and the job is consumed
+    ASSERT_EQ_CHAR(' ', game.board[0][2]);
+    ASSERT_EQ_INT(AI_SEARCH_IDLE, (int)GetAISearchStatus());
+
+    ApplyAIMove(move);
+    ASSERT_EQ_CHAR('O', game.board[0][2]);
+    printf("PASS\n");
+    tests_passed++;
+}
+
+TEST(test_cancel_ai_search_discards_result) {
+    reset_game_for_test();
+    game.difficulty = DIFF_HARD;
+
+    ASSERT_TRUE(SubmitAIMoveSearch());
+    CancelAIMoveSearch();
+
+    // Nothing left to take after a cancel
+    struct Move move;
+    ASSERT_EQ_INT(AI_SEARCH_IDLE, (int)GetAISearchStatus());
+    ASSERT_FALSE(TakeAIMoveResult(&move));
+    printf("PASS\n");
+    tests_passed++;
+}
+
 // ============================================================================
 // TEST GROUP 9: EDGE CASES & INTEGRATION
 // ============================================================================
@@ -1182,6 +1796,709 @@ TEST(test_count_bits_consistency_with_board) {
     tests_passed++;
 }
 
+TEST(test_SaveGame_LoadGame_round_trip) {
+    reset_game_for_test();
+    game.mode = MODE_ONE_PLAYER;
+    game.difficulty = DIFF_HARD;
+    board_from_string(game.board, "XO X     ");
+    RebuildBoardMasks();
+    game.currentPlayer = 'O';
+    game.player1Wins = 3;
+    game.player2Wins = 1;
+    game.draws = 2;
+
+    SaveGame();
+
+    // Wreck the live state, then load it back
+    int savedMaskX = game.maskX, savedMaskO = game.maskO;
+    reset_game_for_test();
+    game.difficulty = DIFF_EASY;
+
+    ASSERT_TRUE(LoadGame());
+    ASSERT_EQ_INT(savedMaskX, game.maskX);
+    ASSERT_EQ_INT(savedMaskO, game.maskO);
+    ASSERT_EQ_INT(DIFF_HARD, game.difficulty);
+    ASSERT_EQ_CHAR('O', game.currentPlayer);
+    ASSERT_EQ_INT(3, game.player1Wins);
+    ASSERT_EQ_INT(1, game.player2Wins);
+    ASSERT_EQ_INT(2, game.draws);
+
+    // Char board is re-derived from the masks
+    ASSERT_EQ_CHAR('X', game.board[0][0]);
+    ASSERT_EQ_CHAR('O', game.board[0][1]);
+    ASSERT_EQ_CHAR(' ', game.board[0][2]);
+    ASSERT_EQ_CHAR('X', game.board[1][0]);
+
+    remove("save.dat");
+    printf("PASS\n");
+    tests_passed++;
+}
+
+TEST(test_LoadGame_rejects_corrupt_file) {
+    reset_game_for_test();
+
+    // Garbage file: wrong magic, must be rejected before touching state
+    FILE *f = fopen("save.dat", "wb");
+    ASSERT_TRUE(f != NULL);
+    const char garbage[] = "definitely not a valid save file payload";
+    fwrite(garbage, sizeof(garbage), 1, f);
+    fclose(f);
+
+    game.player1Wins = 7;
+    ASSERT_FALSE(LoadGame());
+    ASSERT_EQ_INT(7, game.player1Wins); // State untouched on rejection
+
+    // Truncated file: valid-looking start, cut short
+    f = fopen("save.dat", "wb");
+    ASSERT_TRUE(f != NULL);
+    unsigned int magic = 0x53545454u;
+    fwrite(&magic, sizeof(magic), 1, f);
+    fclose(f);
+
+    ASSERT_FALSE(LoadGame());
+
+    remove("save.dat");
+    printf("PASS\n");
+    tests_passed++;
+}
+
+TEST(test_history_index_and_paging) {
+    reset_game_for_test();
+
+    // Write a history larger than one page (64 lines)
+    FILE *f = fopen("game_history.txt", "w");
+    ASSERT_TRUE(f != NULL);
+    for (int i = 0; i < 200; i++) {
+        fprintf(f, "Game %d: Draw\n", i);
+    }
+    fclose(f);
+
+    // Index scan finds every line without loading any content
+    LoadGameHistory();
+    ASSERT_EQ_INT(200, game.historyLineCount);
+    ASSERT_EQ_INT(0, game.historyPageCount);
+
+    // Random access pages lines in on demand
+    char expected[64];
+    sprintf(expected, "Game %d: Draw", 0);
+    ASSERT_TRUE(strcmp(GetHistoryLine(0), expected) == 0);
+
+    sprintf(expected, "Game %d: Draw", 150);
+    ASSERT_TRUE(strcmp(GetHistoryLine(150), expected) == 0);
+
+    sprintf(expected, "Game %d: Draw", 199);
+    ASSERT_TRUE(strcmp(GetHistoryLine(199), expected) == 0);
+
+    // Only a page of lines is resident, never the whole file
+    ASSERT_TRUE(game.historyPageCount <= 64);
+
+    // Out-of-range access is safe
+    ASSERT_TRUE(strcmp(GetHistoryLine(200), "") == 0);
+    ASSERT_TRUE(strcmp(GetHistoryLine(-1), "") == 0);
+
+    ClearGameHistory();
+    ASSERT_EQ_INT(0, game.historyLineCount);
+    remove("game_history.txt");
+    printf("PASS\n");
+    tests_passed++;
+}
+
+TEST(test_history_append_extends_index) {
+    reset_game_for_test();
+    game.mode = MODE_TWO_PLAYER;
+    game.winner = ' ';
+
+    FILE *f = fopen("game_history.txt", "w");
+    ASSERT_TRUE(f != NULL);
+    fprintf(f, "Old entry\n");
+    fclose(f);
+
+    LoadGameHistory();
+    ASSERT_EQ_INT(1, game.historyLineCount);
+
+    // Appending while the index is live must extend it in place
+    AppendGameToHistory();
+    ASSERT_EQ_INT(2, game.historyLineCount);
+    ASSERT_TRUE(strcmp(GetHistoryLine(0), "Old entry") == 0);
+    ASSERT_TRUE(strcmp(GetHistoryLine(1), "2P (Human vs Human): Draw") == 0);
+
+    ClearGameHistory();
+    remove("game_history.txt");
+    printf("PASS\n");
+    tests_passed++;
+}
+
+// ============================================================================
+// TEST GROUP 10: NxN ENGINE (minimax_nxn.c)
+// ============================================================================
+
+TEST(test_nxn_init_3x3_matches_classic_engine) {
+    EngineNxN engine;
+    ASSERT_TRUE(initEngineNxN(&engine, 3, 3));
+    ASSERT_EQ_INT(8, engine.winMaskCount); // 3 rows + 3 cols + 2 diagonals
+
+    // Win detection must agree with the classic 3x3 isWinnerMask
+    for (int mask = 0; mask < 512; mask++) {
+        ASSERT_EQ_INT(isWinnerMask(mask) ? 1 : 0,
+                      isWinnerMaskNxN(&engine, (uint64_t)mask) ? 1 : 0);
+    }
+    // Center-first ordering, like MOVE_ORDER
+    ASSERT_EQ_INT(4, engine.moveOrder[0]);
+    printf("PASS\n");
+    tests_passed++;
+}
+
+TEST(test_nxn_init_4x4_line_count) {
+    EngineNxN engine;
+    ASSERT_TRUE(initEngineNxN(&engine, 4, 4));
+    // 4 rows + 4 cols + 2 diagonals
+    ASSERT_EQ_INT(10, engine.winMaskCount);
+
+    ASSERT_TRUE(initEngineNxN(&engine, 4, 3));
+    // 8 horizontal + 8 vertical + 8 diagonal 3-runs
+    ASSERT_EQ_INT(24, engine.winMaskCount);
+    printf("PASS\n");
+    tests_passed++;
+}
+
+TEST(test_nxn_rejects_invalid_sizes) {
+    EngineNxN engine;
+    ASSERT_FALSE(initEngineNxN(&engine, 2, 2));
+    ASSERT_FALSE(initEngineNxN(&engine, 9, 5));
+    ASSERT_FALSE(initEngineNxN(&engine, 4, 5)); // k longer than the board
+    printf("PASS\n");
+    tests_passed++;
+}
+
+TEST(test_nxn_finds_winning_move_4x4) {
+    EngineNxN engine;
+    ASSERT_TRUE(initEngineNxN(&engine, 4, 3));
+
+    // AI holds cells 0 and 1 of the top row; cell 2 completes 3-in-a-row
+    uint64_t aiMask = ((uint64_t)1 << 0) | ((uint64_t)1 << 1);
+    uint64_t oppMask = ((uint64_t)1 << 5) | ((uint64_t)1 << 9);
+
+    struct Move move = findBestMoveMinimaxNxN(&engine, aiMask, oppMask, 4);
+    ASSERT_TRUE(move.row == 0 && move.col == 2);
+    printf("PASS\n");
+    tests_passed++;
+}
+
+TEST(test_nxn_blocks_opponent_4x4) {
+    EngineNxN engine;
+    ASSERT_TRUE(initEngineNxN(&engine, 4, 3));
+
+    // Opponent threatens cells 0,1 -> 2; AI must block (its own stones
+    // are far from completing anything)
+    uint64_t aiMask = ((uint64_t)1 << 12);
+    uint64_t oppMask = ((uint64_t)1 << 0) | ((uint64_t)1 << 1);
+
+    struct Move move = findBestMoveMinimaxNxN(&engine, aiMask, oppMask, 4);
+    ASSERT_TRUE(move.row == 0 && move.col == 2);
+    printf("PASS\n");
+    tests_passed++;
+}
+
+TEST(test_nxn_explicit_stack_stays_bounded) {
+    EngineNxN engine;
+    ASSERT_TRUE(initEngineNxN(&engine, 5, 4));
+
+    // Deeper searches may not use more than one frame per ply, and never
+    // more than the compile-time capacity
+    struct Move move = findBestMoveMinimaxNxN(&engine, 0, 0, 4);
+    ASSERT_TRUE(move.row >= 0);
+    ASSERT_TRUE(nxnSearchPeakFrames() <= 4);
+
+    move = findBestMoveMinimaxNxN(&engine, 0, 0, 10);
+    ASSERT_TRUE(move.row >= 0);
+    ASSERT_TRUE(nxnSearchPeakFrames() <= 10);
+    ASSERT_TRUE(nxnSearchPeakFrames() <= NXN_SEARCH_MAX_FRAMES);
+    printf("PASS\n");
+    tests_passed++;
+}
+
+// ============================================================================
+// TEST GROUP 11: TABLEBASE (tablebase.c)
+// ============================================================================
+// NOTE: These run after the minimax groups so the earlier tests exercise the
+// recursive fallback search. Once initMinimaxTablebase() is called here,
+// findBestMoveMinimax serves moves from the table for the rest of the run.
+
+TEST(test_tablebase_lookup_unavailable_before_init) {
+    if (!isTablebaseReady()) {
+        ASSERT_EQ_INT(0, tablebaseLookup(0, 0));
+    }
+    printf("PASS\n");
+    tests_passed++;
+}
+
+TEST(test_tablebase_winning_move_only_candidate) {
+    initMinimaxTablebase();
+    ASSERT_TRUE(isTablebaseReady());
+
+    // X: positions 0,1 | O: position 4 - X to move wins only at position 2
+    int candidates = tablebaseLookup(0x3, 0x10);
+    ASSERT_EQ_INT(1 << 2, candidates);
+    printf("PASS\n");
+    tests_passed++;
+}
+
+TEST(test_tablebase_blocking_move_only_candidate) {
+    initMinimaxTablebase();
+
+    // X: position 4 | O: positions 0,1 - X must block at position 2
+    int candidates = tablebaseLookup(0x10, 0x3);
+    ASSERT_EQ_INT(1 << 2, candidates);
+    printf("PASS\n");
+    tests_passed++;
+}
+
+TEST(test_tablebase_perfect_play_always_draws) {
+    initMinimaxTablebase();
+
+    // With the tablebase active, perfect self-play must still always draw
+    srand(1234);
+    for (int game_num = 0; game_num < 50; game_num++) {
+        char board[3][3] = {
+            {' ', ' ', ' '},
+            {' ', ' ', ' '},
+            {' ', ' ', ' '}
+        };
+        char turn = 'X';
+        int moves = 0;
+
+        while (moves < 9) {
+            struct Move m = findBestMoveMinimax(board, turn, 0);
+            ASSERT_TRUE(m.row != -1);
+            board[m.row][m.col] = turn;
+            moves++;
+
+            int maskX, maskO;
+            boardToMasks(board, &maskX, &maskO);
+            ASSERT_FALSE(isWinnerMask(maskX));
+            ASSERT_FALSE(isWinnerMask(maskO));
+
+            turn = (turn == 'X') ? 'O' : 'X';
+        }
+    }
+    printf("PASS\n");
+    tests_passed++;
+}
+
+// ============================================================================
+// TEST GROUP 11B: EXHAUSTIVE PERFECT-PLAY VERIFICATION (Minimax.c)
+// ============================================================================
+// The hand-written fixtures above spot-check a handful of boards; this
+// enumerates EVERY reachable position and asserts the engine's move
+// preserves the game-theoretic value in each one, for both symbols. The
+// reference solver below is a plain memoized recursion that shares no
+// code with the search being verified (only the WIN_MASKS check), so a
+// regression in the transposition table, move-list tables, or tactical
+// shortcuts cannot hide itself. Runs after the tablebase group, so the
+// lookup fast path is under test too.
+
+// Reference value of a position for the side to move: +1 win, 0 draw,
+// -1 loss under perfect play. Memoized on (player << 9) | opp; 127 is
+// the unset sentinel.
+static signed char ref_value_memo[1 << 18];
+
+static int ref_game_value(int player, int opp) {
+    if (isWinnerMask(opp)) return -1; // Previous mover completed a line
+    if ((player | opp) == 0x1FF) return 0;
+
+    int key = (player << 9) | opp;
+    if (ref_value_memo[key] != 127) return ref_value_memo[key];
+
+    int best = -1;
+    for (int pos = 0; pos < 9; pos++) {
+        int bit = 1 << pos;
+        if ((player | opp) & bit) continue;
+        int val = -ref_game_value(opp, player | bit);
+        if (val > best) best = val;
+    }
+
+    ref_value_memo[key] = (signed char)best;
+    return best;
+}
+
+static unsigned char exhaustive_seen[1 << 18];
+static int exhaustive_states;
+static int exhaustive_violations;
+
+/** Checks the engine's move from one state, playing as the given symbol. */
+static void verify_engine_move(int player, int opp, char moverSymbol) {
+    char board[3][3];
+    char oppSymbol = (moverSymbol == 'X') ? 'O' : 'X';
+    for (int pos = 0; pos < 9; pos++) {
+        board[pos / 3][pos % 3] =
+            (player & (1 << pos)) ? moverSymbol :
+            (opp & (1 << pos)) ? oppSymbol : ' ';
+    }
+
+    struct Move move = findBestMoveMinimax(board, moverSymbol, 0);
+    int pos = move.row * 3 + move.col;
+    int legal = (move.row >= 0 && move.row < 3 && move.col >= 0 &&
+                 move.col < 3 && !((player | opp) & (1 << pos)));
+
+    int expected = ref_game_value(player, opp);
+    int achieved = legal ? -ref_game_value(opp, player | (1 << pos)) : -2;
+
+    if (!legal || achieved != expected) {
+        if (exhaustive_violations == 0) {
+            printf("FAIL\n    -> player=0x%03X opp=0x%03X as %c: "
+                   "move (%d,%d) achieves %d, optimal is %d\n",
+                   player, opp, moverSymbol, move.row, move.col,
+                   achieved, expected);
+        }
+        exhaustive_violations++;
+    }
+}
+
+/** DFS over every reachable (side to move, opponent) mask pair. */
+static void verify_all_positions(int player, int opp) {
+    if (isWinnerMask(opp) || (player | opp) == 0x1FF) return;
+
+    int key = (player << 9) | opp;
+    if (exhaustive_seen[key]) return;
+    exhaustive_seen[key] = 1;
+
+    exhaustive_states++;
+    verify_engine_move(player, opp, 'X');
+    verify_engine_move(player, opp, 'O');
+
+    for (int pos = 0; pos < 9; pos++) {
+        int bit = 1 << pos;
+        if ((player | opp) & bit) continue;
+        verify_all_positions(opp, player | bit);
+    }
+}
+
+TEST(test_engine_optimal_in_all_reachable_states) {
+    memset(ref_value_memo, 127, sizeof(ref_value_memo));
+    memset(exhaustive_seen, 0, sizeof(exhaustive_seen));
+    exhaustive_states = 0;
+    exhaustive_violations = 0;
+
+    verify_all_positions(0, 0);
+
+    ASSERT_EQ_INT(0, exhaustive_violations);
+    // 5,478 legal positions minus the 958 finished ones leave 4,520
+    // states that still await a move; each is verified for both symbols
+    ASSERT_EQ_INT(4520, exhaustive_states);
+    printf("PASS\n");
+    tests_passed++;
+}
+
+// ============================================================================
+// TEST GROUP 12: GAME RECORDS (game_record.c)
+// ============================================================================
+
+TEST(test_packMoves_round_trip) {
+    unsigned char moves[9] = {4, 0, 8, 2, 6, 3, 5, 1, 7};
+
+    unsigned long long packed = packMoves(moves, 9);
+    for (int i = 0; i < 9; i++) {
+        ASSERT_EQ_INT(moves[i], unpackMove(packed, i));
+    }
+
+    // A shorter game leaves the unused slots zeroed
+    packed = packMoves(moves, 3);
+    ASSERT_EQ_INT(4, unpackMove(packed, 0));
+    ASSERT_EQ_INT(0, unpackMove(packed, 3));
+    printf("PASS\n");
+    tests_passed++;
+}
+
+TEST(test_game_record_append_and_read) {
+    remove(GAME_RECORD_FILE);
+    reset_game_for_test();
+
+    // Play X wins across the top row: X(0,0) O(1,1) X(0,1) O(2,2) X(0,2)
+    game.mode = MODE_TWO_PLAYER;
+    PlaceSymbol(0, 0, 'X');
+    PlaceSymbol(1, 1, 'O');
+    PlaceSymbol(0, 1, 'X');
+    PlaceSymbol(2, 2, 'O');
+    PlaceSymbol(0, 2, 'X');
+    game.winner = 'X';
+
+    ASSERT_TRUE(AppendGameRecord());
+    ASSERT_EQ_INT(1, CountGameRecords());
+
+    GameRecord record;
+    ASSERT_TRUE(ReadGameRecord(0, &record));
+    ASSERT_EQ_INT(GAME_RECORD_VERSION, record.version);
+    ASSERT_EQ_INT(5, record.moveCount);
+    ASSERT_EQ_INT(0, record.firstPlayer);
+    ASSERT_EQ_CHAR('X', record.winner);
+    ASSERT_EQ_INT(0, unpackMove(record.packedMoves, 0)); // (0,0)
+    ASSERT_EQ_INT(4, unpackMove(record.packedMoves, 1)); // (1,1)
+    ASSERT_EQ_INT(1, unpackMove(record.packedMoves, 2)); // (0,1)
+    ASSERT_EQ_INT(8, unpackMove(record.packedMoves, 3)); // (2,2)
+    ASSERT_EQ_INT(2, unpackMove(record.packedMoves, 4)); // (0,2)
+
+    // A game with an unknown move sequence (resumed save) is not recorded
+    game.movesKnown = false;
+    ASSERT_FALSE(AppendGameRecord());
+    ASSERT_EQ_INT(1, CountGameRecords());
+
+    remove(GAME_RECORD_FILE);
+    printf("PASS\n");
+    tests_passed++;
+}
+
+TEST(test_LoadGameReplay_rebuilds_deltas) {
+    remove(GAME_RECORD_FILE);
+    reset_game_for_test();
+
+    game.mode = MODE_TWO_PLAYER;
+    PlaceSymbol(1, 1, 'X');
+    PlaceSymbol(0, 0, 'O');
+    PlaceSymbol(2, 0, 'X');
+    game.winner = ' ';
+    ASSERT_TRUE(AppendGameRecord());
+
+    ASSERT_TRUE(LoadGameReplay(0));
+    ASSERT_EQ_INT(0, game.replayGameIndex);
+    ASSERT_EQ_INT(0, game.replayStep);
+    ASSERT_EQ_INT(3, game.replayTotalPlies);
+
+    // Delta i is the i-th move of the recorded game
+    ASSERT_EQ_INT(4, game.moveHistory[0].cell); // (1,1)
+    ASSERT_EQ_CHAR('X', game.moveHistory[0].symbol);
+    ASSERT_EQ_INT(0, game.moveHistory[1].cell); // (0,0)
+    ASSERT_EQ_CHAR('O', game.moveHistory[1].symbol);
+    ASSERT_EQ_INT(6, game.moveHistory[2].cell); // (2,0)
+    ASSERT_EQ_CHAR('X', game.moveHistory[2].symbol);
+
+    // An out-of-range index must be rejected
+    ASSERT_FALSE(LoadGameReplay(5));
+
+    remove(GAME_RECORD_FILE);
+    printf("PASS\n");
+    tests_passed++;
+}
+
+// ============================================================================
+// TEST GROUP 13: FRAME PROFILER (profiler.c)
+// ============================================================================
+
+// Stub clock from raylib_stub.c; the profiler reads it through GetTime()
+extern double stub_time;
+
+/** Simulates one main-loop frame taking the given phase durations. */
+static void profiler_run_frame(double handleMs, double drawMs,
+                               double idleMs) {
+    ProfilerFrameBegin();
+    stub_time += handleMs / 1000.0;
+    ProfilerHandlePhaseEnd();
+    stub_time += drawMs / 1000.0;
+    ProfilerDrawPhaseEnd();
+    stub_time += idleMs / 1000.0;
+}
+
+TEST(test_profiler_percentiles_over_ring) {
+    ProfilerReset();
+    stub_time = 100.0;
+
+    // 99 steady 10 ms frames and one 60 ms stutter: the median must stay
+    // at the steady rate while the tail percentiles catch the spike
+    for (int i = 0; i < 99; i++) {
+        profiler_run_frame(1.0, 4.0, 5.0);
+    }
+    profiler_run_frame(1.0, 54.0, 5.0);
+    profiler_run_frame(1.0, 4.0, 5.0); // Commits the stutter sample
+
+    ProfilerStats stats;
+    ProfilerComputeStats(&stats);
+    ASSERT_EQ_INT(100, stats.frames);
+    ASSERT_TRUE(stats.p50Ms > 9.9f && stats.p50Ms < 10.1f);
+    ASSERT_TRUE(stats.p95Ms > 9.9f && stats.p95Ms < 10.1f);
+    ASSERT_TRUE(stats.p99Ms > 59.9f && stats.p99Ms < 60.1f);
+    printf("PASS\n");
+    tests_passed++;
+}
+
+TEST(test_profiler_ring_saturates_at_capacity) {
+    ProfilerReset();
+    stub_time = 100.0;
+
+    // Overfill the ring; the sample count must cap at the ring size and
+    // old samples must be overwritten, not accumulated
+    for (int i = 0; i < PROFILER_RING_FRAMES + 50; i++) {
+        profiler_run_frame(1.0, 4.0, 11.0);
+    }
+
+    ProfilerStats stats;
+    ProfilerComputeStats(&stats);
+    ASSERT_EQ_INT(PROFILER_RING_FRAMES, stats.frames);
+    ASSERT_TRUE(stats.p99Ms > 15.9f && stats.p99Ms < 16.1f);
+
+    // A reset discards everything
+    ProfilerReset();
+    ProfilerComputeStats(&stats);
+    ASSERT_EQ_INT(0, stats.frames);
+    printf("PASS\n");
+    tests_passed++;
+}
+
+TEST(test_profiler_overlay_hidden_by_default) {
+    // Kiosk builds ship with the profiler compiled in but invisible
+    ASSERT_FALSE(ProfilerOverlayVisible());
+    // Drawing while hidden must be a no-op (and must not crash)
+    DrawProfilerOverlay();
+    printf("PASS\n");
+    tests_passed++;
+}
+
+// ============================================================================
+// TEST GROUP 14: RESOURCE CACHE (resource_cache.c)
+// ============================================================================
+
+TEST(test_resource_cache_async_load_and_bind) {
+    ResourceCacheShutdown();
+    ASSERT_FALSE(ResourceCacheSoundsReady());
+
+    // Binding before anything is loaded yields zeroed (silent) handles
+    GameAudio early;
+    memset(&early, 0xFF, sizeof(early));
+    ResourceCacheBindSounds(&early);
+    ASSERT_EQ_INT(0, (int)early.click.frameCount);
+
+    // Kick off the background decode and pump until it commits, the way
+    // the main loop does each frame
+    ResourceCacheBeginLoad();
+    for (long spin = 0; spin < 200000000L && !ResourceCacheSoundsReady();
+         spin++) {
+        ResourceCachePump();
+    }
+    ASSERT_TRUE(ResourceCacheSoundsReady());
+
+    // The commit rebinds game.sfx itself; the stub wave carries 1 frame
+    ASSERT_EQ_INT(1, (int)game.sfx.click.frameCount);
+
+    // A save restore rebinds from the registry - handle copies only
+    GameAudio restored;
+    memset(&restored, 0, sizeof(restored));
+    ResourceCacheBindSounds(&restored);
+    ASSERT_EQ_INT(1, (int)restored.draw.frameCount);
+
+    ResourceCacheShutdown();
+    ASSERT_FALSE(ResourceCacheSoundsReady());
+    printf("PASS\n");
+    tests_passed++;
+}
+
+TEST(test_resource_cache_shutdown_is_safe_anytime) {
+    // Shutdown right after begin must join the loader and drop whatever
+    // it staged without committing
+    ResourceCacheBeginLoad();
+    ResourceCacheShutdown();
+    ASSERT_FALSE(ResourceCacheSoundsReady());
+
+    // And shutting down an empty cache is a no-op
+    ResourceCacheShutdown();
+    ASSERT_FALSE(ResourceCacheSoundsReady());
+    printf("PASS\n");
+    tests_passed++;
+}
+
+// ============================================================================
+// TEST GROUP 15: WRITE-BEHIND JOURNAL (game_state.c)
+// ============================================================================
+
+TEST(test_journal_coalesces_saves_and_loads_newest) {
+    remove("save.dat");
+    reset_game_for_test();
+    JournalStart();
+
+    // Two autosaves in one flush window: only the newest matters
+    game.mode = MODE_ONE_PLAYER;
+    game.difficulty = DIFF_HARD;
+    board_from_string(game.board, "X        ");
+    RebuildBoardMasks();
+    game.player1Wins = 1;
+    SaveGame();
+
+    board_from_string(game.board, "XO       ");
+    RebuildBoardMasks();
+    game.player1Wins = 2;
+    SaveGame();
+
+    int savedMaskX = game.maskX, savedMaskO = game.maskO;
+    reset_game_for_test();
+
+    // LoadGame flushes the journal itself, so it sees the queued save
+    ASSERT_TRUE(LoadGame());
+    ASSERT_EQ_INT(savedMaskX, game.maskX);
+    ASSERT_EQ_INT(savedMaskO, game.maskO);
+    ASSERT_EQ_INT(2, game.player1Wins);
+
+    JournalShutdown();
+    remove("save.dat");
+    printf("PASS\n");
+    tests_passed++;
+}
+
+TEST(test_journal_batches_history_lines) {
+    remove("game_history.txt");
+    remove(GAME_RECORD_FILE);
+    reset_game_for_test();
+    JournalStart();
+
+    // Two game-end appends land in one group commit
+    game.mode = MODE_TWO_PLAYER;
+    game.winner = 'X';
+    AppendGameToHistory();
+    game.winner = ' ';
+    AppendGameToHistory();
+
+    JournalFlush();
+
+    FILE *f = fopen("game_history.txt", "r");
+    ASSERT_TRUE(f != NULL);
+    char line[128];
+    int lines = 0;
+    while (fgets(line, sizeof(line), f) != NULL) {
+        if (lines == 0) {
+            ASSERT_TRUE(strstr(line, "Player 1 (X) Wins") != NULL);
+        }
+        lines++;
+    }
+    fclose(f);
+    ASSERT_EQ_INT(2, lines); // Queued order preserved, nothing dropped
+
+    JournalShutdown();
+    remove("game_history.txt");
+    remove(GAME_RECORD_FILE);
+    printf("PASS\n");
+    tests_passed++;
+}
+
+TEST(test_journal_shutdown_drains_queue) {
+    remove("save.dat");
+    reset_game_for_test();
+    JournalStart();
+
+    board_from_string(game.board, "  X      ");
+    RebuildBoardMasks();
+    SaveGame();
+
+    // Shutdown with no explicit flush must still land the queued save
+    JournalShutdown();
+
+    FILE *f = fopen("save.dat", "rb");
+    ASSERT_TRUE(f != NULL);
+    fclose(f);
+
+    ASSERT_TRUE(LoadGame());
+    ASSERT_EQ_CHAR('X', game.board[0][2]);
+
+    remove("save.dat");
+    printf("PASS\n");
+    tests_passed++;
+}
+
 // ============================================================================
 // MAIN
 // ============================================================================
@@ -1205,6 +2522,10 @@ int main(void) {
     RUN_TEST(test_countBits_empty);
     RUN_TEST(test_countBits_single_bit);
     RUN_TEST(test_countBits_multiple_bits);
+    RUN_TEST(test_MOVE_LISTS_matches_move_order_scan);
+    RUN_TEST(test_findImmediateWin_detects_open_lines);
+    RUN_TEST(test_zobrist_incremental_matches_full_hash);
+    RUN_TEST(test_zobrist_distinguishes_positions);
     RUN_TEST(test_isWinnerMask_no_winner);
     RUN_TEST(test_isWinnerMask_row_wins);
     RUN_TEST(test_isWinnerMask_col_wins);
@@ -1215,10 +2536,20 @@ int main(void) {
     RUN_TEST(test_getPlayerMasks_ai_is_X);
     RUN_TEST(test_getPlayerMasks_mid_game);
     RUN_TEST(test_getPlayerMasks_ai_is_O);
+    RUN_TEST(test_transformMask_identity);
+    RUN_TEST(test_transformMask_rotation_cycle);
+    RUN_TEST(test_canonicalizeMasks_symmetric_variants_agree);
+    RUN_TEST(test_isWinnerMaskAt_matches_isWinnerMask);
+    RUN_TEST(test_rng_seeded_sequences_reproduce);
+    RUN_TEST(test_rngRange_stays_in_bounds_and_covers);
+    RUN_TEST(test_findBestMoveMinimaxRng_replays_with_same_seed);
     printf("\n");
 
     // ---- Group 2: CheckWinner ----
     printf("--- CheckWinner (game_state.c) ---\n");
+    RUN_TEST(test_PlaceSymbol_keeps_masks_in_sync);
+    RUN_TEST(test_CheckWinnerAt_detects_completed_line);
+    RUN_TEST(test_IsBoardFullMask_draw);
     RUN_TEST(test_CheckWinner_empty_board);
     RUN_TEST(test_CheckWinner_row_win);
     RUN_TEST(test_CheckWinner_col_win);
@@ -1249,6 +2580,10 @@ int main(void) {
     RUN_TEST(test_ResetBoard_ai_doesnt_go_first_if_human_is_X);
     RUN_TEST(test_ResetBoard_does_not_reset_stats);
     RUN_TEST(test_ResetBoard_resets_move_count);
+    RUN_TEST(test_UndoLastMove_reverts_single_move);
+    RUN_TEST(test_UndoLastMove_pops_ai_reply_with_human_move);
+    RUN_TEST(test_UndoLastMove_reopens_finished_game);
+    RUN_TEST(test_UndoLastMove_empty_stack_fails);
     printf("\n");
 
     // ---- Group 5: Minimax AI ----
@@ -1257,6 +2592,7 @@ int main(void) {
     RUN_TEST(test_minimax_winning_move_col);
     RUN_TEST(test_minimax_winning_move_diag);
     RUN_TEST(test_minimax_winning_move_anti_diag);
+    RUN_TEST(test_minimax_imperfect_never_misses_own_win);
     RUN_TEST(test_minimax_blocks_opponent_win);
     RUN_TEST(test_minimax_blocks_opponent_col);
     RUN_TEST(test_minimax_takes_center_empty_board);
@@ -1264,6 +2600,7 @@ int main(void) {
     RUN_TEST(test_minimax_never_loses_from_empty);
     RUN_TEST(test_minimax_returns_valid_move);
     RUN_TEST(test_minimax_full_board_returns_invalid);
+    RUN_TEST(test_search_stats_collection);
     RUN_TEST(test_minimax_forks_creates_double_threat);
     printf("\n");
 
@@ -1274,7 +2611,12 @@ int main(void) {
     RUN_TEST(test_model_ai_as_O);
     RUN_TEST(test_evaluateBoardLogistic_empty);
     RUN_TEST(test_evaluateBoardLogistic_x_favorable);
+    RUN_TEST(test_evaluateMovesLogistic_matches_scalar);
+    RUN_TEST(test_evaluateBoardsLogisticBatch_matches_scalar);
     RUN_TEST(test_model_ai_full_board_no_crash);
+    RUN_TEST(test_loadModelParams_round_trip);
+    RUN_TEST(test_loadModelParams_rejects_malformed);
+    RUN_TEST(test_findBestMoveModel_quantized_matches_float);
     printf("\n");
 
     // ---- Group 7: Theme Management ----
@@ -1292,6 +2634,8 @@ int main(void) {
     RUN_TEST(test_MakeAIMove_medium_difficulty);
     RUN_TEST(test_MakeAIMove_easy_difficulty);
     RUN_TEST(test_MakeAIMove_winning_move);
+    RUN_TEST(test_async_ai_search_round_trip);
+    RUN_TEST(test_cancel_ai_search_discards_result);
     printf("\n");
 
     // ---- Group 9: Edge Cases & Integration ----
@@ -1300,11 +2644,61 @@ int main(void) {
     RUN_TEST(test_full_game_simulation);
     RUN_TEST(test_move_order_center_first);
     RUN_TEST(test_win_masks_count);
+    RUN_TEST(test_SaveGame_LoadGame_round_trip);
+    RUN_TEST(test_LoadGame_rejects_corrupt_file);
+    RUN_TEST(test_history_index_and_paging);
+    RUN_TEST(test_history_append_extends_index);
     RUN_TEST(test_check_winner_all_positions_on_full_board);
     RUN_TEST(test_board_to_masks_round_trip);
     RUN_TEST(test_count_bits_consistency_with_board);
     printf("\n");
 
+    // ---- Group 10: NxN Engine ----
+    printf("--- NxN Engine (minimax_nxn.c) ---\n");
+    RUN_TEST(test_nxn_init_3x3_matches_classic_engine);
+    RUN_TEST(test_nxn_init_4x4_line_count);
+    RUN_TEST(test_nxn_rejects_invalid_sizes);
+    RUN_TEST(test_nxn_finds_winning_move_4x4);
+    RUN_TEST(test_nxn_blocks_opponent_4x4);
+    RUN_TEST(test_nxn_explicit_stack_stays_bounded);
+    printf("\n");
+
+    // ---- Group 11: Tablebase ----
+    printf("--- Tablebase (tablebase.c) ---\n");
+    RUN_TEST(test_tablebase_lookup_unavailable_before_init);
+    RUN_TEST(test_tablebase_winning_move_only_candidate);
+    RUN_TEST(test_tablebase_blocking_move_only_candidate);
+    RUN_TEST(test_tablebase_perfect_play_always_draws);
+    RUN_TEST(test_engine_optimal_in_all_reachable_states);
+    printf("\n");
+
+    // ---- Group 12: Game Records ----
+    printf("--- Game Records (game_record.c) ---\n");
+    RUN_TEST(test_packMoves_round_trip);
+    RUN_TEST(test_game_record_append_and_read);
+    RUN_TEST(test_LoadGameReplay_rebuilds_deltas);
+    printf("\n");
+
+    // ---- Group 13: Frame Profiler ----
+    printf("--- Frame Profiler (profiler.c) ---\n");
+    RUN_TEST(test_profiler_percentiles_over_ring);
+    RUN_TEST(test_profiler_ring_saturates_at_capacity);
+    RUN_TEST(test_profiler_overlay_hidden_by_default);
+    printf("\n");
+
+    // ---- Group 14: Resource Cache ----
+    printf("--- Resource Cache (resource_cache.c) ---\n");
+    RUN_TEST(test_resource_cache_async_load_and_bind);
+    RUN_TEST(test_resource_cache_shutdown_is_safe_anytime);
+    printf("\n");
+
+    // ---- Group 15: Write-Behind Journal ----
+    printf("--- Write-Behind Journal (game_state.c) ---\n");
+    RUN_TEST(test_journal_coalesces_saves_and_loads_newest);
+    RUN_TEST(test_journal_batches_history_lines);
+    RUN_TEST(test_journal_shutdown_drains_queue);
+    printf("\n");
+
     // ---- Summary ----
     printf("==============================================================\n");
     printf("  RESULTS: %d/%d passed, %d failed\n",
@@ -24,15 +24,17 @@ echo.
 echo   1. Build only
 echo   2. Run only
 echo   3. Build and Run
-echo   4. Exit
+echo   4. Build headless engine (engine_cli)
+echo   5. Exit
 echo.
 echo ============================================
-set /p choice="Enter your choice (1-4): "
+set /p choice="Enter your choice (1-5): "
 
 if "%choice%"=="1" goto build
 if "%choice%"=="2" goto run
 if "%choice%"=="3" goto build_and_run
-if "%choice%"=="4" goto end
+if "%choice%"=="4" goto build_engine
+if "%choice%"=="5" goto end
 echo Invalid choice! Please try again.
 timeout /t 2 >nul
 goto menu
@@ -48,7 +50,7 @@ REM Create output directory
 if not exist "bin" mkdir bin
 
 REM Compile all source files with static linking (Single line to avoid batch errors)
-gcc -o bin\TicTacToe.exe main.c GUI_handlers\game_state.c GUI_handlers\screens.c GUI_handlers\ui.c Game_algorithms\Minimax.c Game_algorithms\model_minimax.c Game_algorithms\minimax_utils.c -Ilib\raylib -Llib\raylib -lraylib -lopengl32 -lgdi32 -lwinmm -static -lm
+gcc -o bin\TicTacToe.exe main.c GUI_handlers\game_state.c GUI_handlers\game_record.c GUI_handlers\screens.c GUI_handlers\ui.c GUI_handlers\profiler.c GUI_handlers\resource_cache.c Game_algorithms\Minimax.c Game_algorithms\model_minimax.c Game_algorithms\minimax_utils.c Game_algorithms\rng.c Game_algorithms\tablebase.c -Ilib\raylib -Llib\raylib -lraylib -lopengl32 -lgdi32 -lwinmm -pthread -static -lm
 
 if %errorlevel% equ 0 (
     echo.
@@ -100,6 +102,38 @@ popd
 pause
 goto menu
 
+:build_engine
+cls
+echo ============================================
+echo   Building Headless Engine CLI
+echo ============================================
+echo.
+
+REM Create output directory
+if not exist "bin" mkdir bin
+
+REM Engine only - no raylib, no GUI layer, starts in milliseconds
+gcc -o bin\engine_cli.exe engine_cli.c Game_algorithms\Minimax.c Game_algorithms\model_minimax.c Game_algorithms\minimax_utils.c Game_algorithms\rng.c Game_algorithms\tablebase.c -static -lm
+
+if %errorlevel% equ 0 (
+    echo.
+    echo ============================================
+    echo   SUCCESS! Engine CLI compiled.
+    echo   Location: bin\engine_cli.exe
+    echo   Usage: echo move ......... X ^| bin\engine_cli.exe
+    echo ============================================
+) else (
+    echo.
+    echo ============================================
+    echo   COMPILATION FAILED!
+    echo   Check error messages above.
+    echo ============================================
+)
+
+echo.
+pause
+goto menu
+
 :build_and_run
 cls
 echo ========================================
@@ -117,7 +151,7 @@ REM Create output directory
 if not exist "bin" mkdir bin
 
 REM Compile all source files with static linking (Single line to avoid batch errors)
-gcc -o bin\TicTacToe.exe main.c GUI_handlers\game_state.c GUI_handlers\screens.c GUI_handlers\ui.c Game_algorithms\Minimax.c Game_algorithms\model_minimax.c Game_algorithms\minimax_utils.c -Ilib\raylib -Llib\raylib -lraylib -lopengl32 -lgdi32 -lwinmm -static -lm
+gcc -o bin\TicTacToe.exe main.c GUI_handlers\game_state.c GUI_handlers\game_record.c GUI_handlers\screens.c GUI_handlers\ui.c GUI_handlers\profiler.c GUI_handlers\resource_cache.c Game_algorithms\Minimax.c Game_algorithms\model_minimax.c Game_algorithms\minimax_utils.c Game_algorithms\rng.c Game_algorithms\tablebase.c -Ilib\raylib -Llib\raylib -lraylib -lopengl32 -lgdi32 -lwinmm -pthread -static -lm
 
 if %errorlevel% equ 0 (
     echo.
@@ -0,0 +1,142 @@
+/**
+ * @file engine_cli.c
+ * @brief Headless stdin/stdout front end for the AI engine
+ *
+ * Links only the Game_algorithms engine - no raylib, no window or audio
+ * initialization - so it starts in milliseconds and is cheap to invoke
+ * from scripted pipelines. One command per line; every response is one
+ * line, flushed immediately, so thousands of positions can be scored in
+ * a single invocation by piping in a file of commands (batch mode).
+ *
+ * PROTOCOL (one command per line)
+ *   move <board> <symbol> [errorRate]   Best engine move, printed "row col"
+ *   model <board> <symbol>              Logistic-model move, printed "row col"
+ *   help                                Print a protocol summary
+ *   quit                                Exit (EOF also exits)
+ *
+ * <board> is 9 characters, row-major: 'X', 'O', or '.' for an empty cell.
+ * <symbol> is the side to move ('X' or 'O'). <errorRate> is the 0-100
+ * forced-randomness percentage (default 0 = perfect play). A full board
+ * answers "-1 -1"; malformed input answers a line starting "error:".
+ *
+ * Example batch session:
+ *   $ printf "move ......... X\nmove X...O.... O\n" | engine_cli
+ *   1 1
+ *   0 2
+ */
+
+#include "Game_algorithms/minimax.h"
+#include "Game_algorithms/model_minimax.h"
+#include "Game_algorithms/tablebase.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/**
+ * @brief Parses a 9-character board token into the 3x3 char board.
+ *
+ * @param token Row-major board string ('X', 'O', '.')
+ * @param board Output board (empty cells become ' ')
+ * @return 1 on success, 0 if the token is malformed
+ */
+static int parseBoard(const char *token, char board[3][3])
+{
+    if (strlen(token) != 9) {
+        return 0;
+    }
+    for (int i = 0; i < 9; i++) {
+        char c = token[i];
+        if (c != 'X' && c != 'O' && c != '.') {
+            return 0;
+        }
+        board[i / 3][i % 3] = (c == '.') ? ' ' : c;
+    }
+    return 1;
+}
+
+static void printHelp(void)
+{
+    printf("commands:\n");
+    printf("  move <board> <symbol> [errorRate]   best engine move -> \"row col\"\n");
+    printf("  model <board> <symbol>              logistic-model move -> \"row col\"\n");
+    printf("  help                                this summary\n");
+    printf("  quit                                exit\n");
+    printf("board: 9 chars row-major, 'X'/'O'/'.'  symbol: side to move\n");
+}
+
+int main(void)
+{
+    // Randomized tie-breaks and the errorRate roll draw from the
+    // engine-default Rng; seed it per invocation
+    minimaxSeedDefaultRng((uint64_t)time(NULL));
+
+    // Pick up retrained model parameters when a params file is present;
+    // the compiled-in defaults remain in effect otherwise.
+    if (!loadModelParams("logistic_regression_params.json")) {
+        loadModelParams("Game_algorithms/logistic_regression_params.json");
+    }
+
+    // Startup cost is the tablebase build (a few ms); after this, hard
+    // and medium moves are array lookups, which is what makes large
+    // batch invocations practical.
+    initMinimaxTablebase();
+
+    char line[256];
+    while (fgets(line, sizeof(line), stdin) != NULL) {
+        char cmd[16], boardToken[16], symbolToken[16];
+        int errorRate = 0;
+        char board[3][3];
+
+        int fields = sscanf(line, "%15s %15s %15s %d",
+                            cmd, boardToken, symbolToken, &errorRate);
+        if (fields <= 0) {
+            continue; // Blank line
+        }
+
+        if (strcmp(cmd, "quit") == 0) {
+            break;
+        }
+        if (strcmp(cmd, "help") == 0) {
+            printHelp();
+            fflush(stdout);
+            continue;
+        }
+
+        if (strcmp(cmd, "move") != 0 && strcmp(cmd, "model") != 0) {
+            printf("error: unknown command '%s' (try 'help')\n", cmd);
+            fflush(stdout);
+            continue;
+        }
+
+        // Shared validation for move/model
+        if (fields < 3 || !parseBoard(boardToken, board)) {
+            printf("error: expected %s <board> <symbol>\n", cmd);
+            fflush(stdout);
+            continue;
+        }
+        char symbol = symbolToken[0];
+        if (symbolToken[1] != '\0' || (symbol != 'X' && symbol != 'O')) {
+            printf("error: symbol must be X or O\n");
+            fflush(stdout);
+            continue;
+        }
+        if (errorRate < 0 || errorRate > 100) {
+            printf("error: errorRate must be 0-100\n");
+            fflush(stdout);
+            continue;
+        }
+
+        struct Move move;
+        if (strcmp(cmd, "move") == 0) {
+            move = findBestMoveMinimax(board, symbol, errorRate);
+        } else {
+            move = findBestMoveModel(board, symbol);
+        }
+
+        printf("%d %d\n", move.row, move.col);
+        fflush(stdout);
+    }
+
+    return 0;
+}
@@ -9,6 +9,52 @@
 #include "raylib.h"
 #include "GUI_handlers/game_state.h"
 #include "GUI_handlers/screens.h"
+#include "GUI_handlers/profiler.h"
+#include "GUI_handlers/resource_cache.h"
+
+// Frame budget used when a redraw is skipped (matches SetTargetFPS below)
+#define FRAME_TIME (1.0 / 60.0)
+
+/**
+ * @brief Decides whether anything on screen could have changed this frame.
+ *
+ * OPTIMIZATION: Static screens (menus, instructions between animation
+ * ticks) used to be fully redrawn 60 times a second. A frame only needs
+ * drawing when there was user input (hover states, clicks, scrolling,
+ * key presses, a resize) or when the current screen runs a timer or
+ * animation. Everything the Handle* functions mutate is triggered by one
+ * of those two, so checking them covers every state change.
+ *
+ * @return true if the draw phase must run this frame
+ */
+static bool FrameNeedsRedraw(void)
+{
+    // The profiler overlay updates its numbers every frame
+    if (ProfilerOverlayVisible()) return true;
+
+    // Any user input can change hover effects or trigger an action
+    Vector2 mouseDelta = GetMouseDelta();
+    if (mouseDelta.x != 0.0f || mouseDelta.y != 0.0f) return true;
+    if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) return true;
+    if (IsMouseButtonReleased(MOUSE_LEFT_BUTTON)) return true;
+    if (GetMouseWheelMove() != 0.0f) return true;
+    if (GetKeyPressed() != 0) return true;
+    if (IsWindowResized()) return true;
+
+    // Screens with running timers or animations redraw continuously
+    switch (game.screen)
+    {
+        case SCREEN_INSTRUCTIONS:
+            return true; // Win-pattern demo animates on its own
+        case SCREEN_START:
+            return game.saveMessageTimer > 0;
+        case SCREEN_GAME:
+            // AI "thinking" delay counts down; save message fades out
+            return game.aiTurn || game.saveMessageTimer > 0;
+        default:
+            return false;
+    }
+}
 
 /**
  * @brief Main entry point
@@ -49,8 +95,20 @@ int main(void)
      * * This separation of "Handling" (logic) and "Drawing" (rendering)
      * is a fundamental and clean pattern for game development.
      */
+    // Force a draw on the first frame and for one frame after any dirty
+    // frame, so transitions (e.g. a timer expiring) render their end state
+    bool wasDirty = true;
+
     while (!WindowShouldClose())
     {
+        // Commits the previous frame's timing sample and handles the F3
+        // profiler overlay toggle
+        ProfilerFrameBegin();
+
+        // Commits background-decoded resources once they are ready
+        // (a couple of flag checks on every other frame)
+        ResourceCachePump();
+
         // --------------------------------------------------------------------
         // Input Processing / Logic Phase
         // --------------------------------------------------------------------
@@ -82,6 +140,9 @@ int main(void)
             case SCREEN_HISTORY:
                 HandleHistoryScreen();
                 break;
+            case SCREEN_REPLAY:
+                HandleReplayScreen();
+                break;
             case SCREEN_GAME:
                 HandleGameScreen();
                 break;
@@ -93,10 +154,23 @@ int main(void)
                 game.screen = SCREEN_START;
                 break;
         }
-        
+        ProfilerHandlePhaseEnd();
+
         // ====================================================================
         // RENDERING PHASE
         // ====================================================================
+        // OPTIMIZATION: Skip the whole draw phase when nothing changed.
+        // EndDrawing normally polls input and paces the frame, so the skip
+        // path has to do both by hand.
+        bool dirty = FrameNeedsRedraw();
+        if (!dirty && !wasDirty)
+        {
+            PollInputEvents();
+            WaitTime(FRAME_TIME);
+            continue;
+        }
+        wasDirty = dirty;
+
         BeginDrawing();
         
         // Clear the background with the *current* theme's background color
@@ -130,6 +204,9 @@ int main(void)
             case SCREEN_HISTORY:
                 DrawHistoryScreen();
                 break;
+            case SCREEN_REPLAY:
+                DrawReplayScreen();
+                break;
             case SCREEN_GAME:
                 DrawGameScreen();
                 break;
@@ -148,7 +225,12 @@ int main(void)
                 game.screen = SCREEN_START;
                 break;
         }
-        
+        ProfilerDrawPhaseEnd();
+
+        // Rendered last (and timed separately above) so the overlay's own
+        // cost never pollutes the screen it is profiling
+        DrawProfilerOverlay();
+
         EndDrawing();
     }
      // OPTIMIZATION: Clean up dynamic memory before exit
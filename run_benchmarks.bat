@@ -22,15 +22,19 @@ if not exist "bin" mkdir bin
 REM ================================================================
 REM   COMPILE BENCHMARK.C
 REM ================================================================
-echo [1/2] Compiling benchmark.c...
+echo [1/4] Compiling benchmark.c...
 echo ----------------------------------------------------------------
 
 gcc -o "bin\benchmark.exe" ^
     "Benchmark Files\benchmark.c" ^
     "Benchmark Files\benchmark_algorithms.c" ^
+    "Benchmark Files\bench_harness.c" ^
     "Game_algorithms\Minimax.c" ^
     "Game_algorithms\minimax_utils.c" ^
+    "Game_algorithms\rng.c" ^
+    "Game_algorithms\tablebase.c" ^
     "Game_algorithms\model_minimax.c" ^
+    "Game_algorithms\minimax_nxn.c" ^
     -I"Game_algorithms" ^
     -I"Benchmark Files" ^
     -static -lm
@@ -50,18 +54,18 @@ echo.
 REM ================================================================
 REM   COMPILE SIMULATION.C
 REM ================================================================
-echo [2/2] Compiling simulation.c...
+echo [2/4] Compiling simulation.c...
 echo ----------------------------------------------------------------
 
 gcc -o "bin\simulation.exe" ^
     "Benchmark Files\simulation.c" ^
-    "GUI_handlers\game_state.c" ^
     "Game_algorithms\Minimax.c" ^
     "Game_algorithms\model_minimax.c" ^
     "Game_algorithms\minimax_utils.c" ^
-    -I"lib\raylib" ^
-    -L"lib\raylib" ^
-    -lraylib -lopengl32 -lgdi32 -lwinmm ^
+    "Game_algorithms\rng.c" ^
+    "Game_algorithms\tablebase.c" ^
+    -I"Game_algorithms" ^
+    -pthread ^
     -static -lm
 
 if %errorlevel% neq 0 (
@@ -76,16 +80,75 @@ if %errorlevel% neq 0 (
 echo [SUCCESS] simulation.exe created in bin\
 echo.
 
+REM ================================================================
+REM   COMPILE TOURNAMENT.C
+REM ================================================================
+echo [3/4] Compiling tournament.c...
+echo ----------------------------------------------------------------
+
+gcc -o "bin\tournament.exe" ^
+    "Benchmark Files\tournament.c" ^
+    "Game_algorithms\Minimax.c" ^
+    "Game_algorithms\model_minimax.c" ^
+    "Game_algorithms\minimax_utils.c" ^
+    "Game_algorithms\rng.c" ^
+    "Game_algorithms\tablebase.c" ^
+    -I"Game_algorithms" ^
+    -pthread ^
+    -static -lm
+
+if %errorlevel% neq 0 (
+    echo.
+    echo [ERROR] tournament.c compilation FAILED!
+    echo Check error messages above.
+    echo.
+    pause
+    exit /b 1
+)
+
+echo [SUCCESS] tournament.exe created in bin\
+echo.
+
+REM ================================================================
+REM   COMPILE BATCH_SIM.C
+REM ================================================================
+echo [4/4] Compiling batch_sim.c...
+echo ----------------------------------------------------------------
+
+gcc -o "bin\batch_sim.exe" ^
+    "Benchmark Files\batch_sim.c" ^
+    "Game_algorithms\Minimax.c" ^
+    "Game_algorithms\model_minimax.c" ^
+    "Game_algorithms\minimax_utils.c" ^
+    "Game_algorithms\rng.c" ^
+    "Game_algorithms\tablebase.c" ^
+    -I"Game_algorithms" ^
+    -static -lm
+
+if %errorlevel% neq 0 (
+    echo.
+    echo [ERROR] batch_sim.c compilation FAILED!
+    echo Check error messages above.
+    echo.
+    pause
+    exit /b 1
+)
+
+echo [SUCCESS] batch_sim.exe created in bin\
+echo.
+
 
 echo ================================================================
 echo   COMPILATION COMPLETE!
 echo ================================================================
 echo.
-echo Both benchmark programs have been compiled successfully.
+echo All benchmark programs have been compiled successfully.
 echo.
 echo Available executables:
 echo   - bin\benchmark.exe   : Performance benchmarking
 echo   - bin\simulation.exe  : AI difficulty simulation
+echo   - bin\tournament.exe  : Parameter-sweep tournament (CSV report)
+echo   - bin\batch_sim.exe   : Struct-of-arrays million-game simulation
 echo.
 echo ----------------------------------------------------------------
 echo.
@@ -98,15 +161,19 @@ echo What would you like to run?
 echo.
 echo   1. Run benchmark.exe (Performance benchmarking)
 echo   2. Run simulation.exe (AI difficulty simulation)
-echo   3. Run both (benchmark first, then simulation)
-echo   4. Exit
+echo   3. Run tournament.exe (Parameter-sweep tournament)
+echo   4. Run batch_sim.exe (Struct-of-arrays batch simulation)
+echo   5. Run both (benchmark first, then simulation)
+echo   6. Exit
 echo.
-set /p choice="Enter your choice (1-4): "
+set /p choice="Enter your choice (1-6): "
 
 if "%choice%"=="1" goto run_benchmark
 if "%choice%"=="2" goto run_simulation
-if "%choice%"=="3" goto run_both
-if "%choice%"=="4" goto end
+if "%choice%"=="3" goto run_tournament
+if "%choice%"=="4" goto run_batch_sim
+if "%choice%"=="5" goto run_both
+if "%choice%"=="6" goto end
 
 echo Invalid choice. Please try again.
 echo.
@@ -168,6 +235,63 @@ echo.
 pause
 goto menu
 
+:run_tournament
+echo.
+echo ================================================================
+echo   RUNNING TOURNAMENT.EXE
+echo ================================================================
+echo.
+if not exist "bin\tournament.exe" (
+    echo ERROR: bin\tournament.exe not found! Please compile first.
+    pause
+    goto menu
+)
+pushd bin
+if %errorlevel% neq 0 (
+    echo ERROR: Failed to enter bin directory!
+    popd
+    pause
+    goto menu
+)
+tournament.exe
+popd
+echo.
+echo ================================================================
+echo   TOURNAMENT COMPLETE
+echo ================================================================
+echo Results are in bin\tournament_results.csv
+echo.
+pause
+goto menu
+
+:run_batch_sim
+echo.
+echo ================================================================
+echo   RUNNING BATCH_SIM.EXE
+echo ================================================================
+echo.
+if not exist "bin\batch_sim.exe" (
+    echo ERROR: bin\batch_sim.exe not found! Please compile first.
+    pause
+    goto menu
+)
+pushd bin
+if %errorlevel% neq 0 (
+    echo ERROR: Failed to enter bin directory!
+    popd
+    pause
+    goto menu
+)
+batch_sim.exe
+popd
+echo.
+echo ================================================================
+echo   BATCH SIMULATION COMPLETE
+echo ================================================================
+echo.
+pause
+goto menu
+
 :run_both
 echo.
 echo ================================================================
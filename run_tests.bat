@@ -25,11 +25,18 @@ gcc -o Tests\test_suite.exe ^
     Tests\test_suite.c ^
     Tests\raylib_stub.c ^
     GUI_handlers\game_state.c ^
+    GUI_handlers\game_record.c ^
+    GUI_handlers\profiler.c ^
+    GUI_handlers\resource_cache.c ^
     Game_algorithms\Minimax.c ^
     Game_algorithms\minimax_utils.c ^
+    Game_algorithms\rng.c ^
+    Game_algorithms\tablebase.c ^
+    Game_algorithms\minimax_nxn.c ^
     Game_algorithms\model_minimax.c ^
     -Ilib\raylib ^
     -I. ^
+    -pthread ^
     -lm
 
 if %errorlevel% neq 0 (
@@ -0,0 +1,74 @@
+@echo off
+
+REM Pre-flight: Check if gcc is available
+where gcc >nul 2>nul
+if %errorlevel% neq 0 (
+    echo ================================================================
+    echo   ERROR: GCC not found in PATH!
+    echo   Please install MinGW/MSYS2 and add gcc to your system PATH.
+    echo ================================================================
+    pause
+    exit /b 1
+)
+
+echo ================================================================
+echo   TIC-TAC-TOE MODEL TRAINING PIPELINE
+echo ================================================================
+echo.
+
+REM Create output directory for binaries
+if not exist "bin" mkdir bin
+
+REM ================================================================
+REM   COMPILE TRAIN_MODEL.C
+REM ================================================================
+echo [1/1] Compiling train_model.c...
+echo ----------------------------------------------------------------
+
+gcc -o "bin\train_model.exe" ^
+    "Benchmark Files\train_model.c" ^
+    "Game_algorithms\Minimax.c" ^
+    "Game_algorithms\model_minimax.c" ^
+    "Game_algorithms\minimax_utils.c" ^
+    "Game_algorithms\rng.c" ^
+    "Game_algorithms\tablebase.c" ^
+    -I"Game_algorithms" ^
+    -static -lm
+
+if %errorlevel% neq 0 (
+    echo.
+    echo [ERROR] train_model.c compilation FAILED!
+    echo Check error messages above.
+    echo.
+    pause
+    exit /b 1
+)
+
+echo [SUCCESS] train_model.exe created in bin\
+echo.
+
+REM ================================================================
+REM   RUN TRAINING
+REM ================================================================
+echo ================================================================
+echo   RUNNING TRAIN_MODEL.EXE
+echo ================================================================
+echo.
+pushd bin
+if %errorlevel% neq 0 (
+    echo ERROR: Failed to enter bin directory!
+    pause
+    exit /b 1
+)
+train_model.exe
+popd
+echo.
+echo ================================================================
+echo   TRAINING COMPLETE
+echo ================================================================
+echo.
+echo The updated parameters in logistic_regression_params.json are
+echo loaded automatically the next time the game or engine starts.
+echo No rebuild is required.
+echo.
+pause